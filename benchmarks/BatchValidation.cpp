@@ -0,0 +1,185 @@
+#include <Math/Batch.hpp>
+#include <Math/Frustum.hpp>
+#include <Math/Matrix4x4.hpp>
+#include <Math/Plane.hpp>
+#include <Math/Sphere.hpp>
+#include <Math/Vector3.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Culls the same spheres with every batch path the processor supports, and checks that each one
+// finds exactly the spheres the scalar path finds, and that those are the ones Sphere decides are
+// visible. Sphere counts around the kernel widths check the tails the narrower paths finish.
+
+static constexpr std::array<std::size_t, 14> k_sphere_counts = { 0, 1, 3, 4, 5, 7, 8, 9, 63, 64, 65, 127, 1'000, 100'003 };
+static constexpr std::array<MG3TR::Math::BatchInstructionSet, 3> k_instruction_sets = {
+    MG3TR::Math::BatchInstructionSet::Scalar,
+    MG3TR::Math::BatchInstructionSet::SSE4,
+    MG3TR::Math::BatchInstructionSet::AVX2
+};
+
+static constexpr float k_scene_half_size = 500.0F;
+
+struct Spheres
+{
+    std::vector<float> m_centers_x;
+    std::vector<float> m_centers_y;
+    std::vector<float> m_centers_z;
+    std::vector<float> m_radii;
+};
+
+static MG3TR::Frustum CreateFrustum()
+{
+    const MG3TR::Matrix4x4 view = MG3TR::Matrix4x4::LookAt(MG3TR::Vector3(0.0F, 0.0F, 0.0F),
+                                                           MG3TR::Vector3(1.0F, 0.2F, 0.5F),
+                                                           MG3TR::Vector3(0.0F, 1.0F, 0.0F));
+    const MG3TR::Matrix4x4 projection = MG3TR::Matrix4x4::Perspective(1.57F, 16.0F / 9.0F, 0.1F, 600.0F);
+
+    const MG3TR::Frustum frustum(projection * view);
+    return frustum;
+}
+
+
+
+// Every fourth sphere is placed to just touch one of the planes, where rounding decides its side, so
+// a path that sums the signed distance in another order would disagree on some of them.
+static Spheres CreateSpheres(const std::size_t count, const MG3TR::Frustum &frustum)
+{
+    const std::array<MG3TR::Plane, 6> planes = { frustum.GetLeftFace(), frustum.GetRightFace(), frustum.GetFarFace(),
+                                                 frustum.GetNearFace(), frustum.GetTopFace(), frustum.GetBottomFace() };
+
+    std::mt19937 generator(42U);
+    std::uniform_real_distribution<float> position_distribution(-k_scene_half_size, k_scene_half_size);
+    std::uniform_real_distribution<float> radius_distribution(0.5F, 5.0F);
+
+    Spheres spheres;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        MG3TR::Vector3 center(position_distribution(generator), position_distribution(generator),
+                              position_distribution(generator));
+        const float radius = radius_distribution(generator);
+
+        if ((i % 4) == 0)
+        {
+            const MG3TR::Plane &plane = planes[(i / 4) % planes.size()];
+            center = center - (plane.GetNormal() * (plane.GetSignedDistance(center) + radius));
+        }
+
+        spheres.m_centers_x.push_back(center.x());
+        spheres.m_centers_y.push_back(center.y());
+        spheres.m_centers_z.push_back(center.z());
+        spheres.m_radii.push_back(radius);
+    }
+
+    return spheres;
+}
+
+
+
+static std::vector<std::uint64_t> Cull(const Spheres &spheres, const MG3TR::Frustum &frustum,
+                                       const MG3TR::Math::BatchInstructionSet instruction_set)
+{
+    std::vector<std::uint64_t> visibility(MG3TR::Math::GetVisibilityWordCount(spheres.m_radii.size()));
+
+    MG3TR::Math::CullSpheres(frustum, spheres.m_centers_x, spheres.m_centers_y, spheres.m_centers_z, spheres.m_radii,
+                             visibility, instruction_set);
+    return visibility;
+}
+
+
+
+static std::size_t CountSphereMismatches(const Spheres &spheres, const MG3TR::Frustum &frustum,
+                                         const std::vector<std::uint64_t> &visibility)
+{
+    std::size_t mismatch_count = 0;
+
+    for (std::size_t i = 0; i < spheres.m_radii.size(); ++i)
+    {
+        const MG3TR::Sphere sphere(MG3TR::Vector3(spheres.m_centers_x[i], spheres.m_centers_y[i], spheres.m_centers_z[i]),
+                                   spheres.m_radii[i]);
+        const bool is_visible = sphere.IsOnOrInFrontOfPlane(frustum.GetLeftFace())
+                                && sphere.IsOnOrInFrontOfPlane(frustum.GetRightFace())
+                                && sphere.IsOnOrInFrontOfPlane(frustum.GetFarFace())
+                                && sphere.IsOnOrInFrontOfPlane(frustum.GetNearFace())
+                                && sphere.IsOnOrInFrontOfPlane(frustum.GetTopFace())
+                                && sphere.IsOnOrInFrontOfPlane(frustum.GetBottomFace());
+        const bool is_batch_visible = ((visibility[i / 64] >> (i % 64)) & 1U) != 0U;
+
+        if (is_visible != is_batch_visible)
+        {
+            ++mismatch_count;
+        }
+    }
+
+    return mismatch_count;
+}
+
+
+
+static std::string GetInstructionSetName(const MG3TR::Math::BatchInstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case MG3TR::Math::BatchInstructionSet::AVX2:
+            return "AVX2";
+        case MG3TR::Math::BatchInstructionSet::SSE4:
+            return "SSE4.1";
+        case MG3TR::Math::BatchInstructionSet::Scalar:
+            return "scalar";
+    }
+
+    return "unknown";
+}
+
+
+
+int main()
+{
+    const MG3TR::Frustum frustum = CreateFrustum();
+    const MG3TR::Math::BatchInstructionSet supported_instruction_set = MG3TR::Math::GetBatchInstructionSet();
+
+    bool are_all_matching = true;
+
+    for (const std::size_t count : k_sphere_counts)
+    {
+        const Spheres spheres = CreateSpheres(count, frustum);
+        const std::vector<std::uint64_t> scalar_visibility = Cull(spheres, frustum, MG3TR::Math::BatchInstructionSet::Scalar);
+
+        const std::size_t sphere_mismatch_count = CountSphereMismatches(spheres, frustum, scalar_visibility);
+        are_all_matching = are_all_matching && (sphere_mismatch_count == 0);
+
+        (void)(std::cout << std::format("{:>6} spheres: scalar {}", count,
+                                        (sphere_mismatch_count == 0) ? "matches Sphere" : "DIFFERS FROM SPHERE") << std::endl);
+
+        for (const MG3TR::Math::BatchInstructionSet instruction_set : k_instruction_sets)
+        {
+            if ((instruction_set == MG3TR::Math::BatchInstructionSet::Scalar) || (instruction_set > supported_instruction_set))
+            {
+                continue;
+            }
+
+            const bool is_matching = (Cull(spheres, frustum, instruction_set) == scalar_visibility);
+            are_all_matching = are_all_matching && is_matching;
+
+            (void)(std::cout << std::format("{:>6} spheres: {} {}", count, GetInstructionSetName(instruction_set),
+                                            is_matching ? "matches scalar" : "DIFFERS FROM SCALAR") << std::endl);
+        }
+    }
+
+    if (supported_instruction_set != k_instruction_sets.back())
+    {
+        (void)(std::cout << std::format("Paths wider than {} are not supported here and were not checked.",
+                                        GetInstructionSetName(supported_instruction_set)) << std::endl);
+    }
+
+    const int exit_code = are_all_matching ? 0 : 1;
+    return exit_code;
+}
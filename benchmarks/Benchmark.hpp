@@ -0,0 +1,55 @@
+#ifndef MG3TR_BENCHMARKS_BENCHMARK_HPP_INCLUDED
+#define MG3TR_BENCHMARKS_BENCHMARK_HPP_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace MG3TR::Benchmark
+{
+    // Runs prepare and then run the given number of times, and returns the median time of run alone.
+    template<typename PrepareFunction, typename RunFunction>
+    double MeasureMedianMilliseconds(const std::size_t repetitions, const PrepareFunction &prepare, const RunFunction &run)
+    {
+        std::vector<double> times;
+        times.reserve(repetitions);
+
+        for (std::size_t i = 0; i < repetitions; ++i)
+        {
+            prepare();
+
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const auto end = std::chrono::steady_clock::now();
+
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+
+        std::sort(times.begin(), times.end());
+
+        const double median = times[times.size() / 2];
+        return median;
+    }
+
+    template<typename RunFunction>
+    double MeasureMedianMilliseconds(const std::size_t repetitions, const RunFunction &run)
+    {
+        const double median = MeasureMedianMilliseconds(repetitions, []() {}, run);
+        return median;
+    }
+
+    // Keeps the compiler from dropping the computation of a value that is otherwise unused.
+    template<typename Value>
+    void KeepValue(const Value &value)
+    {
+#if defined(_MSC_VER)
+        static const void *volatile s_sink = nullptr;
+        s_sink = &value;
+#else
+        asm volatile("" : : "r"(&value) : "memory");
+#endif
+    }
+}
+
+#endif // MG3TR_BENCHMARKS_BENCHMARK_HPP_INCLUDED
@@ -0,0 +1,186 @@
+#include "Benchmark.hpp"
+
+#include <Math/Batch.hpp>
+#include <Math/BoundingVolumeHierarchy.hpp>
+#include <Math/Frustum.hpp>
+#include <Math/Matrix4x4.hpp>
+#include <Math/Sphere.hpp>
+#include <Math/Vector3.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Culls 100k bounding spheres against one camera, one sphere at a time, with Math::CullSpheres, and
+// through the bounding volume hierarchy, and checks that all three find the same visible spheres.
+
+static constexpr std::size_t k_sphere_count = 100'000;
+static constexpr std::size_t k_repetitions = 50;
+
+static constexpr float k_scene_half_size = 500.0F;
+
+static std::vector<MG3TR::Sphere> CreateSpheres()
+{
+    std::mt19937 generator(42U);
+    std::uniform_real_distribution<float> position_distribution(-k_scene_half_size, k_scene_half_size);
+    std::uniform_real_distribution<float> radius_distribution(0.5F, 5.0F);
+
+    std::vector<MG3TR::Sphere> spheres;
+    spheres.reserve(k_sphere_count);
+
+    for (std::size_t i = 0; i < k_sphere_count; ++i)
+    {
+        const MG3TR::Vector3 center(position_distribution(generator), position_distribution(generator),
+                                    position_distribution(generator));
+        spheres.emplace_back(center, radius_distribution(generator));
+    }
+
+    return spheres;
+}
+
+
+
+// A camera in the middle of the scene, which sees about a fifth of it.
+static MG3TR::Frustum CreateFrustum()
+{
+    const MG3TR::Matrix4x4 view = MG3TR::Matrix4x4::LookAt(MG3TR::Vector3(0.0F, 0.0F, 0.0F),
+                                                           MG3TR::Vector3(1.0F, 0.2F, 0.5F),
+                                                           MG3TR::Vector3(0.0F, 1.0F, 0.0F));
+    const MG3TR::Matrix4x4 projection = MG3TR::Matrix4x4::Perspective(1.57F, 16.0F / 9.0F, 0.1F, 600.0F);
+
+    const MG3TR::Frustum frustum(projection * view);
+    return frustum;
+}
+
+
+
+static bool IsVisible(const MG3TR::Sphere &sphere, const MG3TR::Frustum &frustum)
+{
+    const bool is_visible = sphere.IsOnOrInFrontOfPlane(frustum.GetLeftFace())
+                            && sphere.IsOnOrInFrontOfPlane(frustum.GetRightFace())
+                            && sphere.IsOnOrInFrontOfPlane(frustum.GetTopFace())
+                            && sphere.IsOnOrInFrontOfPlane(frustum.GetBottomFace())
+                            && sphere.IsOnOrInFrontOfPlane(frustum.GetNearFace())
+                            && sphere.IsOnOrInFrontOfPlane(frustum.GetFarFace());
+    return is_visible;
+}
+
+
+
+static std::string GetInstructionSetName(const MG3TR::Math::BatchInstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case MG3TR::Math::BatchInstructionSet::AVX2:
+            return "AVX2";
+        case MG3TR::Math::BatchInstructionSet::SSE4:
+            return "SSE4.1";
+        case MG3TR::Math::BatchInstructionSet::Scalar:
+            return "scalar";
+    }
+
+    return "unknown";
+}
+
+
+
+int main()
+{
+    const std::vector<MG3TR::Sphere> spheres = CreateSpheres();
+    const MG3TR::Frustum frustum = CreateFrustum();
+
+    (void)(std::cout << std::format("{} spheres, {} batch path, median of {} runs.", k_sphere_count,
+                                    GetInstructionSetName(MG3TR::Math::GetBatchInstructionSet()), k_repetitions) << std::endl);
+
+    // One sphere at a time, the way culling was done before the batch path.
+    std::vector<std::uint8_t> is_visible(k_sphere_count);
+
+    const double single_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions, [&spheres, &frustum, &is_visible]()
+    {
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+        {
+            is_visible[i] = IsVisible(spheres[i], frustum) ? 1U : 0U;
+        }
+
+        MG3TR::Benchmark::KeepValue(is_visible);
+    });
+
+    // Packed once, as the frustum culler keeps them.
+    std::vector<float> centers_x;
+    std::vector<float> centers_y;
+    std::vector<float> centers_z;
+    std::vector<float> radii;
+
+    for (const MG3TR::Sphere &sphere : spheres)
+    {
+        centers_x.push_back(sphere.GetCenter().x());
+        centers_y.push_back(sphere.GetCenter().y());
+        centers_z.push_back(sphere.GetCenter().z());
+        radii.push_back(sphere.GetRadius());
+    }
+
+    std::vector<std::uint64_t> visibility(MG3TR::Math::GetVisibilityWordCount(k_sphere_count));
+
+    const double batch_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions,
+        [&frustum, &centers_x, &centers_y, &centers_z, &radii, &visibility]()
+    {
+        MG3TR::Math::CullSpheres(frustum, centers_x, centers_y, centers_z, radii, visibility);
+        MG3TR::Benchmark::KeepValue(visibility);
+    });
+
+    MG3TR::BoundingVolumeHierarchy hierarchy;
+    std::vector<MG3TR::TBVHProxy> proxies;
+
+    for (const MG3TR::Sphere &sphere : spheres)
+    {
+        proxies.push_back(hierarchy.Insert(sphere));
+    }
+    hierarchy.Update();
+
+    std::vector<MG3TR::TBVHProxy> visible_proxies;
+
+    const double hierarchy_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions,
+        [&visible_proxies]() { visible_proxies.clear(); },
+        [&hierarchy, &frustum, &visible_proxies]()
+    {
+        hierarchy.CullFrustum(frustum, visible_proxies);
+        MG3TR::Benchmark::KeepValue(visible_proxies);
+    });
+
+    std::vector<MG3TR::TBVHProxy> expected_proxies;
+    std::size_t batch_mismatch_count = 0;
+
+    for (std::size_t i = 0; i < k_sphere_count; ++i)
+    {
+        const bool is_batch_visible = ((visibility[i / 64] >> (i % 64)) & 1U) != 0U;
+        if (is_batch_visible != (is_visible[i] != 0U))
+        {
+            ++batch_mismatch_count;
+        }
+
+        if (is_visible[i] != 0U)
+        {
+            expected_proxies.push_back(proxies[i]);
+        }
+    }
+
+    std::sort(expected_proxies.begin(), expected_proxies.end());
+    std::sort(visible_proxies.begin(), visible_proxies.end());
+    const bool is_hierarchy_matching = (visible_proxies == expected_proxies);
+
+    (void)(std::cout << std::format("{} of {} spheres visible.", expected_proxies.size(), k_sphere_count) << std::endl);
+    (void)(std::cout << std::format("One at a time:       {:>7.3f} ms", single_time) << std::endl);
+    (void)(std::cout << std::format("Math::CullSpheres:   {:>7.3f} ms, {:>5.2f}x, {} mismatches", batch_time,
+                                    single_time / batch_time, batch_mismatch_count) << std::endl);
+    (void)(std::cout << std::format("Hierarchy:           {:>7.3f} ms, {:>5.2f}x, {}", hierarchy_time,
+                                    single_time / hierarchy_time,
+                                    is_hierarchy_matching ? "same spheres" : "DIFFERENT SPHERES") << std::endl);
+
+    const int exit_code = ((batch_mismatch_count == 0) && is_hierarchy_matching) ? 0 : 1;
+    return exit_code;
+}
@@ -0,0 +1,139 @@
+#include "Benchmark.hpp"
+
+#include <Math/Matrix4x4.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Vector3.hpp>
+#include <Utils/JobSystem.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Times the job system with 1 to 16 threads: a ParallelFor over independent work, a graph that fans
+// out and back in, and the cost of running many empty jobs.
+
+static constexpr std::size_t k_element_count = 1'000'000;
+static constexpr std::size_t k_elements_per_job = 4'096;
+static constexpr std::size_t k_graph_job_count = 64;
+static constexpr std::size_t k_empty_job_count = 100'000;
+static constexpr std::size_t k_repetitions = 10;
+static constexpr std::array<std::size_t, 5> k_thread_counts = { 1, 2, 4, 8, 16 };
+
+// Independent per-element work of about the size of a transform update.
+static void ComposeMatrices(const std::size_t begin, const std::size_t end, std::vector<MG3TR::Matrix4x4> &matrices)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float value = static_cast<float>(i) * 0.001F;
+        const MG3TR::Vector3 position(value, -value, 2.0F * value);
+        const MG3TR::Quaternion rotation(MG3TR::Vector3(value, 0.5F * value, 0.25F * value));
+        const MG3TR::Vector3 scale(1.0F + value, 1.0F, 1.0F);
+
+        matrices[i] = MG3TR::Matrix4x4::InverseTRS(MG3TR::Matrix4x4::FromTRS(position, rotation, scale));
+    }
+}
+
+
+
+// Every job composes its own share of the matrices, and a last job waits for all of them.
+static MG3TR::JobGraph CreateFanGraph(std::vector<MG3TR::Matrix4x4> &matrices, std::atomic<std::size_t> &finished_count)
+{
+    MG3TR::JobGraph graph;
+    std::vector<MG3TR::TJobID> jobs;
+
+    const std::size_t elements_per_job = k_element_count / k_graph_job_count;
+
+    for (std::size_t i = 0; i < k_graph_job_count; ++i)
+    {
+        jobs.push_back(graph.AddJob([&matrices, i, elements_per_job]()
+        {
+            ComposeMatrices(i * elements_per_job, (i + 1) * elements_per_job, matrices);
+        }));
+    }
+
+    const MG3TR::TJobID last_job = graph.AddJob([&finished_count]()
+    {
+        (void)finished_count.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    for (const MG3TR::TJobID job : jobs)
+    {
+        graph.AddDependency(last_job, job);
+    }
+
+    return graph;
+}
+
+
+
+int main()
+{
+    auto& job_system = MG3TR::JobSystem::GetInstance();
+
+    std::vector<MG3TR::Matrix4x4> matrices(k_element_count);
+    std::atomic<std::size_t> finished_count(0);
+    const MG3TR::JobGraph graph = CreateFanGraph(matrices, finished_count);
+
+    (void)(std::cout << std::format("{} hardware threads, median of {} runs.", std::thread::hardware_concurrency(),
+                                    k_repetitions) << std::endl);
+    (void)(std::cout << std::format("ParallelFor: {} elements in jobs of {}. Graph: {} jobs and one that waits for them. "
+                                    "Empty jobs: {} jobs of one element.", k_element_count, k_elements_per_job,
+                                    k_graph_job_count, k_empty_job_count) << std::endl);
+
+    double single_thread_for_time = 0.0;
+    double single_thread_graph_time = 0.0;
+
+    for (const std::size_t thread_count : k_thread_counts)
+    {
+        job_system.SetThreadCount(thread_count);
+
+        const double for_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions, [&job_system, &matrices]()
+        {
+            job_system.ParallelFor(k_element_count, k_elements_per_job, [&matrices](const std::size_t begin, const std::size_t end)
+            {
+                ComposeMatrices(begin, end, matrices);
+            });
+
+            MG3TR::Benchmark::KeepValue(matrices);
+        });
+
+        const double graph_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions, [&job_system, &graph, &matrices]()
+        {
+            job_system.Run(graph);
+            MG3TR::Benchmark::KeepValue(matrices);
+        });
+
+        const double empty_time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions, [&job_system]()
+        {
+            job_system.ParallelFor(k_empty_job_count, 1, []([[maybe_unused]] const std::size_t begin,
+                                                             [[maybe_unused]] const std::size_t end) {});
+        });
+
+        if (thread_count == 1)
+        {
+            single_thread_for_time = for_time;
+            single_thread_graph_time = graph_time;
+        }
+
+        const double nanoseconds_per_empty_job = (empty_time * 1'000'000.0) / static_cast<double>(k_empty_job_count);
+
+        (void)(std::cout << std::format("{:>2} threads: ParallelFor {:>7.2f} ms ({:>5.2f}x), graph {:>7.2f} ms ({:>5.2f}x), "
+                                        "{:>6.1f} ns per empty job", thread_count, for_time, single_thread_for_time / for_time,
+                                        graph_time, single_thread_graph_time / graph_time, nanoseconds_per_empty_job) << std::endl);
+    }
+
+    job_system.SetThreadCount(1);
+
+    const bool has_graph_finished = (finished_count.load() == (k_thread_counts.size() * k_repetitions));
+    if (!has_graph_finished)
+    {
+        (void)(std::cout << "The last job of the graph did not run every time." << std::endl);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include "Benchmark.hpp"
+
+#include <Math/Matrix4x4.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Vector3.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares TRS composition and the affine and TRS inverses of Matrix4x4 against the generic paths
+// they replace: the Translate, Rotate and Scale chain, and the full 4x4 inverse.
+
+// Small enough for the matrices to stay in the cache, so that the arithmetic is measured.
+static constexpr std::size_t k_matrix_count = 16'384;
+static constexpr std::size_t k_repetitions = 50;
+
+struct TRS
+{
+    MG3TR::Vector3 m_position;
+    MG3TR::Quaternion m_rotation;
+    MG3TR::Vector3 m_scale;
+};
+
+static std::vector<TRS> CreateTRSs()
+{
+    std::mt19937 generator(42U);
+    std::uniform_real_distribution<float> position_distribution(-100.0F, 100.0F);
+    std::uniform_real_distribution<float> angle_distribution(-3.14F, 3.14F);
+    std::uniform_real_distribution<float> scale_distribution(0.1F, 10.0F);
+
+    std::vector<TRS> trss;
+    trss.reserve(k_matrix_count);
+
+    for (std::size_t i = 0; i < k_matrix_count; ++i)
+    {
+        const MG3TR::Vector3 position(position_distribution(generator), position_distribution(generator),
+                                      position_distribution(generator));
+        const MG3TR::Vector3 angles(angle_distribution(generator), angle_distribution(generator),
+                                    angle_distribution(generator));
+        const MG3TR::Vector3 scale(scale_distribution(generator), scale_distribution(generator),
+                                   scale_distribution(generator));
+
+        trss.push_back(TRS{ position, MG3TR::Quaternion(angles), scale });
+    }
+
+    return trss;
+}
+
+
+
+static MG3TR::Matrix4x4 ComposeGeneric(const TRS &trs)
+{
+    auto mat = MG3TR::Matrix4x4(1.0F);
+    (void)mat.Translate(trs.m_position);
+    (void)mat.Rotate(trs.m_rotation);
+    (void)mat.Scale(trs.m_scale);
+
+    return mat;
+}
+
+
+
+// Largest difference between matching elements, relative to the largest element of the reference.
+static float GetRelativeError(const std::vector<MG3TR::Matrix4x4> &matrices,
+                              const std::vector<MG3TR::Matrix4x4> &references)
+{
+    float max_error = 0.0F;
+
+    for (std::size_t i = 0; i < matrices.size(); ++i)
+    {
+        float max_reference = 0.0F;
+        float max_difference = 0.0F;
+
+        for (std::size_t row = 0; row < 4; ++row)
+        {
+            for (std::size_t col = 0; col < 4; ++col)
+            {
+                max_reference = std::max(max_reference, std::abs(references[i][row, col]));
+                max_difference = std::max(max_difference, std::abs(matrices[i][row, col] - references[i][row, col]));
+            }
+        }
+
+        max_error = std::max(max_error, max_difference / max_reference);
+    }
+
+    return max_error;
+}
+
+
+
+template<typename Input, typename Operation>
+static double MeasureNanosecondsPerMatrix(const std::vector<Input> &inputs, std::vector<MG3TR::Matrix4x4> &outputs,
+                                          const Operation &operation)
+{
+    const double time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions, [&inputs, &outputs, &operation]()
+    {
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+        {
+            outputs[i] = operation(inputs[i]);
+        }
+
+        MG3TR::Benchmark::KeepValue(outputs);
+    });
+
+    const double nanoseconds_per_matrix = (time * 1'000'000.0) / static_cast<double>(inputs.size());
+    return nanoseconds_per_matrix;
+}
+
+
+
+static void PrintResult(const std::string &name, const double time, const double reference_time, const float error)
+{
+    (void)(std::cout << std::format("{:<24} {:>7.2f} ns, {:>5.2f}x, relative error {:.2e}", name, time,
+                                    reference_time / time, error) << std::endl);
+}
+
+
+
+int main()
+{
+#if defined(MG3TR_SIMD_SSE)
+    const std::string simd_path = "SSE";
+#elif defined(MG3TR_SIMD_NEON)
+    const std::string simd_path = "NEON";
+#else
+    const std::string simd_path = "scalar";
+#endif
+
+    (void)(std::cout << std::format("{} matrices, {} SIMD path, median of {} runs, time per matrix.",
+                                    k_matrix_count, simd_path, k_repetitions) << std::endl);
+
+    const std::vector<TRS> trss = CreateTRSs();
+
+    std::vector<MG3TR::Matrix4x4> generic_matrices(k_matrix_count);
+    std::vector<MG3TR::Matrix4x4> matrices(k_matrix_count);
+
+    const double generic_compose_time = MeasureNanosecondsPerMatrix(trss, generic_matrices, [](const TRS &trs)
+    {
+        return ComposeGeneric(trs);
+    });
+    const double compose_time = MeasureNanosecondsPerMatrix(trss, matrices, [](const TRS &trs)
+    {
+        return MG3TR::Matrix4x4::FromTRS(trs.m_position, trs.m_rotation, trs.m_scale);
+    });
+
+    PrintResult("Translate, Rotate, Scale", generic_compose_time, generic_compose_time, 0.0F);
+    PrintResult("FromTRS", compose_time, generic_compose_time, GetRelativeError(matrices, generic_matrices));
+
+    const std::vector<MG3TR::Matrix4x4> trs_matrices = matrices;
+    std::vector<MG3TR::Matrix4x4> generic_inverses(k_matrix_count);
+
+    const double generic_inverse_time = MeasureNanosecondsPerMatrix(trs_matrices, generic_inverses,
+        [](const MG3TR::Matrix4x4 &m) { return MG3TR::Matrix4x4::Inverse(m); });
+    const double affine_inverse_time = MeasureNanosecondsPerMatrix(trs_matrices, matrices,
+        [](const MG3TR::Matrix4x4 &m) { return MG3TR::Matrix4x4::InverseAffine(m); });
+    const float affine_inverse_error = GetRelativeError(matrices, generic_inverses);
+    const double trs_inverse_time = MeasureNanosecondsPerMatrix(trs_matrices, matrices,
+        [](const MG3TR::Matrix4x4 &m) { return MG3TR::Matrix4x4::InverseTRS(m); });
+    const float trs_inverse_error = GetRelativeError(matrices, generic_inverses);
+
+    PrintResult("Inverse", generic_inverse_time, generic_inverse_time, 0.0F);
+    PrintResult("InverseAffine", affine_inverse_time, generic_inverse_time, affine_inverse_error);
+    PrintResult("InverseTRS", trs_inverse_time, generic_inverse_time, trs_inverse_error);
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <Components/Component.hpp>
+#include <Scene/Scene.hpp>
+#include <Scripting/GameObject.hpp>
+#include <Scripting/Transform.hpp>
+
+#include <format>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// Checks that the lookups of a scene follow renames, UID changes, reparenting and added and removed
+// components once the lookup indices are built, and that objects outside the scene are not found.
+
+// Exposes SetUID, which only components call on themselves otherwise.
+class UIDComponent : public MG3TR::Component
+{
+public:
+    UIDComponent(const std::weak_ptr<MG3TR::GameObject> &game_object, const std::weak_ptr<MG3TR::Transform> &transform)
+        : MG3TR::Component(game_object, transform)
+    {
+
+    }
+
+    void ChangeUID(const MG3TR::TUID uid)
+    {
+        SetUID(uid);
+    }
+
+    virtual void Serialise([[maybe_unused]] MG3TR::ISerialiser &serialiser) override
+    {
+
+    }
+
+    virtual void Deserialise([[maybe_unused]] MG3TR::IDeserialiser &deserialiser) override
+    {
+
+    }
+};
+
+
+
+static bool Check(const std::string &name, const bool is_passing)
+{
+    (void)(std::cout << std::format("{:<48} {}", name, is_passing ? "passed" : "FAILED") << std::endl);
+    return is_passing;
+}
+
+
+
+int main()
+{
+    MG3TR::Scene scene;
+
+    auto transform = MG3TR::Transform::Create();
+    transform->SetParent(scene.GetRootTransform());
+
+    auto game_object = MG3TR::GameObject::Create("Original");
+    game_object->SetTransform(transform);
+    transform->SetGameObject(game_object);
+
+    auto component = std::make_shared<UIDComponent>(game_object, transform);
+    game_object->AddComponent(component);
+
+    bool are_all_passing = true;
+
+    // Builds the indices, which every later change then has to keep up to date.
+    are_all_passing &= Check("Transform found", scene.FindTransformWithUID(transform->GetUID()) == transform);
+    are_all_passing &= Check("Game object found", scene.FindGameObjectWithUID(game_object->GetUID()) == game_object);
+    are_all_passing &= Check("Component found", scene.FindComponentWithUID(component->GetUID()) == component);
+
+    const MG3TR::TUID previous_uid = component->GetUID();
+    const MG3TR::TUID new_uid = previous_uid + 1'000'000U;
+    component->ChangeUID(new_uid);
+
+    are_all_passing &= Check("Component found by its new UID", scene.FindComponentWithUID(new_uid) == component);
+    are_all_passing &= Check("Component not found by its previous UID", scene.FindComponentWithUID(previous_uid) == nullptr);
+
+    game_object->SetName("Renamed");
+
+    const auto renamed_game_objects = scene.FindGameObjectsWithName("Renamed");
+    are_all_passing &= Check("Game object found by its new name",
+                             (renamed_game_objects.size() == 1U) && (renamed_game_objects.front() == game_object));
+    are_all_passing &= Check("Game object not found by its previous name", scene.FindGameObjectsWithName("Original").empty());
+
+    // Moved under a transform that is not part of any scene, then back.
+    auto detached_parent = MG3TR::Transform::Create();
+    transform->SetParent(detached_parent);
+
+    are_all_passing &= Check("Detached transform not found", scene.FindTransformWithUID(transform->GetUID()) == nullptr);
+    are_all_passing &= Check("Detached component not found", scene.FindComponentWithUID(new_uid) == nullptr);
+
+    transform->SetParent(scene.GetRootTransform());
+
+    are_all_passing &= Check("Reattached transform found", scene.FindTransformWithUID(transform->GetUID()) == transform);
+    are_all_passing &= Check("Reattached component found", scene.FindComponentWithUID(new_uid) == component);
+
+    game_object->RemoveComponent(component);
+
+    are_all_passing &= Check("Removed component not found", scene.FindComponentWithUID(new_uid) == nullptr);
+
+    // Changed while outside the scene, which is then not told about it.
+    component->ChangeUID(previous_uid);
+    game_object->AddComponent(component);
+
+    are_all_passing &= Check("Component added with a changed UID found", scene.FindComponentWithUID(previous_uid) == component);
+
+    MG3TR::Scene other_scene;
+    auto other_transform = MG3TR::Transform::Create();
+    other_transform->SetParent(other_scene.GetRootTransform());
+
+    are_all_passing &= Check("Transform of another scene not found", scene.FindTransformWithUID(other_transform->GetUID()) == nullptr);
+
+    const int exit_code = are_all_passing ? 0 : 1;
+    return exit_code;
+}
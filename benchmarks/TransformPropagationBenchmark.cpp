@@ -0,0 +1,147 @@
+#include "Benchmark.hpp"
+
+#include <Math/Matrix4x4.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Vector3.hpp>
+#include <Scripting/TransformHierarchy.hpp>
+#include <Utils/JobSystem.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Propagates the world transforms of a generated scene with 1 to 16 job system threads, and checks
+// that every thread count gives the same matrices as a single thread.
+
+static constexpr std::size_t k_node_count = 1'000'000;
+static constexpr std::size_t k_root_count = 64;
+static constexpr std::size_t k_repetitions = 10;
+static constexpr std::array<std::size_t, 5> k_thread_counts = { 1, 2, 4, 8, 16 };
+
+// Every node after the roots gets a parent picked uniformly from the nodes created before it, which
+// gives a few dozen levels of a few thousand to a hundred thousand transforms each.
+static std::vector<MG3TR::TTransformHandle> CreateScene()
+{
+    auto& hierarchy = MG3TR::TransformHierarchy::GetInstance();
+
+    std::mt19937 generator(42U);
+    std::uniform_real_distribution<float> position_distribution(-10.0F, 10.0F);
+    std::uniform_real_distribution<float> angle_distribution(-3.14F, 3.14F);
+    std::uniform_real_distribution<float> scale_distribution(0.5F, 2.0F);
+
+    std::vector<MG3TR::TTransformHandle> handles;
+    handles.reserve(k_node_count);
+
+    for (std::size_t i = 0; i < k_node_count; ++i)
+    {
+        const MG3TR::TTransformHandle handle = hierarchy.Create();
+
+        if (i >= k_root_count)
+        {
+            std::uniform_int_distribution<std::size_t> parent_distribution(0, handles.size() - 1);
+            hierarchy.SetParent(handle, handles[parent_distribution(generator)]);
+        }
+
+        const MG3TR::Vector3 position(position_distribution(generator), position_distribution(generator),
+                                      position_distribution(generator));
+        const MG3TR::Vector3 angles(angle_distribution(generator), angle_distribution(generator),
+                                    angle_distribution(generator));
+        const MG3TR::Vector3 scale(scale_distribution(generator), scale_distribution(generator),
+                                   scale_distribution(generator));
+
+        hierarchy.SetLocalPosition(handle, position);
+        hierarchy.SetLocalRotation(handle, MG3TR::Quaternion(angles));
+        hierarchy.SetLocalScale(handle, scale);
+
+        handles.push_back(handle);
+    }
+
+    return handles;
+}
+
+
+
+// Moving the roots makes every transform of the scene dirty.
+static void MoveRoots(const std::vector<MG3TR::TTransformHandle> &handles)
+{
+    auto& hierarchy = MG3TR::TransformHierarchy::GetInstance();
+
+    for (std::size_t i = 0; i < k_root_count; ++i)
+    {
+        const MG3TR::Vector3 position = hierarchy.GetLocalPosition(handles[i]);
+        hierarchy.SetLocalPosition(handles[i], position);
+    }
+}
+
+
+
+static std::vector<MG3TR::Matrix4x4> GetWorldMatrices(const std::vector<MG3TR::TTransformHandle> &handles)
+{
+    auto& hierarchy = MG3TR::TransformHierarchy::GetInstance();
+
+    std::vector<MG3TR::Matrix4x4> matrices;
+    matrices.reserve(handles.size());
+
+    for (const MG3TR::TTransformHandle handle : handles)
+    {
+        matrices.push_back(hierarchy.GetWorldMatrix(handle));
+    }
+
+    return matrices;
+}
+
+
+
+int main()
+{
+    auto& hierarchy = MG3TR::TransformHierarchy::GetInstance();
+    auto& job_system = MG3TR::JobSystem::GetInstance();
+
+    const std::vector<MG3TR::TTransformHandle> handles = CreateScene();
+
+    (void)(std::cout << std::format("{} transforms, {} hardware threads, median of {} runs.",
+                                    k_node_count, std::thread::hardware_concurrency(), k_repetitions) << std::endl);
+
+    // The transforms are created parents first, which is already a valid order for one thread. Propagating
+    // once with several threads stores them level by level, so that every thread count runs over the same layout.
+    job_system.SetThreadCount(2);
+    hierarchy.UpdateWorldTransforms();
+
+    std::vector<MG3TR::Matrix4x4> reference_matrices;
+    double single_thread_time = 0.0;
+    bool are_all_matching = true;
+
+    for (const std::size_t thread_count : k_thread_counts)
+    {
+        job_system.SetThreadCount(thread_count);
+
+        const double time = MG3TR::Benchmark::MeasureMedianMilliseconds(k_repetitions,
+            [&handles]() { MoveRoots(handles); },
+            [&hierarchy]() { hierarchy.UpdateWorldTransforms(); });
+
+        const std::vector<MG3TR::Matrix4x4> matrices = GetWorldMatrices(handles);
+        if (reference_matrices.empty())
+        {
+            reference_matrices = matrices;
+            single_thread_time = time;
+        }
+
+        const bool is_matching = (std::memcmp(matrices.data(), reference_matrices.data(),
+                                              matrices.size() * sizeof(MG3TR::Matrix4x4)) == 0);
+        are_all_matching = are_all_matching && is_matching;
+
+        (void)(std::cout << std::format("{:>2} threads: {:>8.2f} ms, {:>5.2f}x, {}", thread_count, time,
+                                        single_thread_time / time,
+                                        is_matching ? "matches 1 thread" : "DIFFERS FROM 1 THREAD") << std::endl);
+    }
+
+    job_system.SetThreadCount(1);
+
+    const int exit_code = are_all_matching ? 0 : 1;
+    return exit_code;
+}
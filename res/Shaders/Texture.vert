@@ -1,18 +1,38 @@
 #version 430
 
-uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
+layout(std140, binding = 0) uniform CameraBlock
+{
+    mat4 u_view;
+    mat4 u_projection;
+    mat4 u_view_projection;
+    vec4 u_camera_position;
+};
 
 layout(location = 0) in vec3 in_vertex_position;
+#ifdef MG3TR_OCTAHEDRAL_NORMALS
+layout(location = 1) in vec2 in_vertex_normal;
+#else
 layout(location = 1) in vec3 in_vertex_normal;
+#endif
 layout(location = 2) in vec2 in_vertex_uv;
 
+#ifdef MG3TR_INSTANCED
+layout(location = 3) in mat4 in_instance_model;
+#else
+layout(location = 0) uniform mat4 u_model;
+#endif
+
 layout(location = 0) out vec2 out_uv;
 
 void main()
 {
-    gl_Position = u_projection * u_view * u_model * vec4(in_vertex_position, 1.0);
+#ifdef MG3TR_INSTANCED
+    mat4 model = in_instance_model;
+#else
+    mat4 model = u_model;
+#endif
+
+    gl_Position = u_view_projection * model * vec4(in_vertex_position, 1.0);
 
 	out_uv = in_vertex_uv;
 }
@@ -1,8 +1,15 @@
 #version 430
 
+layout(std140, binding = 0) uniform CameraBlock
+{
+    mat4 u_view;
+    mat4 u_projection;
+    mat4 u_view_projection;
+    vec4 u_camera_position;
+};
+
 uniform sampler2D u_texture_0;
-uniform vec3 u_camera_position;
-uniform vec3 u_light_position;
+layout(location = 1) uniform vec3 u_light_position;
 
 layout(location = 0) in vec3 in_world_position;
 layout(location = 1) in vec3 in_world_normal;
@@ -25,7 +32,7 @@ void main()
 
     vec3 normal = normalize(in_world_normal);
     vec3 light_direction = normalize(u_light_position - in_world_position);
-    vec3 view_direction = normalize(u_camera_position - in_world_position);
+    vec3 view_direction = normalize(u_camera_position.xyz - in_world_position);
     vec3 reflection_direction = reflect(light_direction, normal);
 
     float ambient_light = k_ambient;
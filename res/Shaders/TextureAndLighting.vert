@@ -1,22 +1,63 @@
 #version 430
 
-uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
+layout(std140, binding = 0) uniform CameraBlock
+{
+    mat4 u_view;
+    mat4 u_projection;
+    mat4 u_view_projection;
+    vec4 u_camera_position;
+};
 
 layout(location = 0) in vec3 in_vertex_position;
+#ifdef MG3TR_OCTAHEDRAL_NORMALS
+layout(location = 1) in vec2 in_vertex_normal;
+#else
 layout(location = 1) in vec3 in_vertex_normal;
+#endif
 layout(location = 2) in vec2 in_vertex_uv;
 
+#ifdef MG3TR_INSTANCED
+layout(location = 3) in mat4 in_instance_model;
+#else
+layout(location = 0) uniform mat4 u_model;
+#endif
+
 layout(location = 0) out vec3 out_world_position;
 layout(location = 1) out vec3 out_world_normal;
 layout(location = 2) out vec2 out_uv;
 
+#ifdef MG3TR_OCTAHEDRAL_NORMALS
+vec3 DecodeOctahedralNormal(vec2 encoded)
+{
+    vec3 normal = vec3(encoded, 1.0F - abs(encoded.x) - abs(encoded.y));
+
+    if (normal.z < 0.0F)
+    {
+        vec2 signs = vec2(normal.x >= 0.0F ? 1.0F : -1.0F, normal.y >= 0.0F ? 1.0F : -1.0F);
+        normal.xy = (1.0F - abs(normal.yx)) * signs;
+    }
+
+    return normalize(normal);
+}
+#endif
+
 void main()
 {
-    gl_Position = u_projection * u_view * u_model * vec4(in_vertex_position, 1.0);
+#ifdef MG3TR_INSTANCED
+    mat4 model = in_instance_model;
+#else
+    mat4 model = u_model;
+#endif
+
+#ifdef MG3TR_OCTAHEDRAL_NORMALS
+    vec3 normal = DecodeOctahedralNormal(in_vertex_normal);
+#else
+    vec3 normal = in_vertex_normal;
+#endif
+
+    gl_Position = u_view_projection * model * vec4(in_vertex_position, 1.0);
 
-    out_world_position = (u_model * vec4(in_vertex_position, 1.0F)).xyz;
-	out_world_normal = (u_model * vec4(in_vertex_normal, 1.0F)).xyz;
+    out_world_position = (model * vec4(in_vertex_position, 1.0F)).xyz;
+	out_world_normal = (model * vec4(normal, 1.0F)).xyz;
 	out_uv = in_vertex_uv;
 }
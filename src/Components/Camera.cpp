@@ -1,16 +1,24 @@
 #include "Camera.hpp"
 
 #include <Constants/ComponentConstants.hpp>
+#include <Constants/GraphicsConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
+#include <Graphics/CameraUniformBlock.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Scripting/Transform.hpp>
 #include <Serialisation/IDeserialiser.hpp>
 #include <Serialisation/ISerialiser.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
+#include <cstring>
+
 namespace MG3TR
 {
     Camera::Camera(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform)
-        : Component(game_object, transform)
+        : Component(game_object, transform),
+          m_uniform_buffer(std::make_shared<UniformBuffer>()),
+          m_frustum_transform_version(0),
+          m_is_frustum_dirty(true)
     {
 
     }
@@ -22,7 +30,10 @@ namespace MG3TR
             m_fov(fov),
             m_aspect_ratio(aspect_ratio),
             m_znear(znear),
-            m_zfar(zfar)
+            m_zfar(zfar),
+            m_uniform_buffer(std::make_shared<UniformBuffer>()),
+            m_frustum_transform_version(0),
+            m_is_frustum_dirty(true)
     {
 
     }
@@ -36,7 +47,10 @@ namespace MG3TR
             m_ymin(ymin),
             m_ymax(ymax),
             m_znear(znear),
-            m_zfar(zfar)
+            m_zfar(zfar),
+            m_uniform_buffer(std::make_shared<UniformBuffer>()),
+            m_frustum_transform_version(0),
+            m_is_frustum_dirty(true)
     {
 
     }
@@ -122,6 +136,57 @@ namespace MG3TR
         return m_zfar;
     }
 
+    const Frustum& Camera::GetFrustum()
+    {
+        const std::uint32_t transform_version = GetTransform().lock()->GetWorldVersion();
+
+        if (m_is_frustum_dirty || (transform_version != m_frustum_transform_version))
+        {
+            const Matrix4x4 view_projection = GetProjectionMatrix() * GetViewMatrix();
+
+            m_frustum = Frustum(view_projection);
+            m_frustum_transform_version = transform_version;
+            m_is_frustum_dirty = false;
+        }
+
+        return m_frustum;
+    }
+
+    CameraUniformBlock Camera::CreateUniformBlock() const
+    {
+        const Matrix4x4 view = GetViewMatrix();
+        const Matrix4x4 projection = GetProjectionMatrix();
+        const Matrix4x4 view_projection = projection * view;
+        const Vector3 position = GetTransform().lock()->GetWorldPosition();
+
+        CameraUniformBlock block;
+
+        (void)std::memcpy(block.m_view, view.InternalDataPointer(), sizeof(block.m_view));
+        (void)std::memcpy(block.m_projection, projection.InternalDataPointer(), sizeof(block.m_projection));
+        (void)std::memcpy(block.m_view_projection, view_projection.InternalDataPointer(), sizeof(block.m_view_projection));
+        block.m_camera_position[0] = position.x();
+        block.m_camera_position[1] = position.y();
+        block.m_camera_position[2] = position.z();
+        block.m_camera_position[3] = 1.0F;
+
+        return block;
+    }
+
+    std::shared_ptr<const UniformBuffer> Camera::GetUniformBuffer() const
+    {
+        return m_uniform_buffer;
+    }
+
+    TUpdatePhaseMask Camera::GetUpdatePhases() const
+    {
+        return k_no_update_phases;
+    }
+
+    void Camera::SubmitToRenderQueue() const
+    {
+        RenderQueue::GetInstance().SubmitCamera(m_uniform_buffer, CreateUniformBlock());
+    }
+
     void Camera::Serialise(ISerialiser &serialiser)
     {
         namespace Constants = CameraSerialisationConstants;
@@ -163,5 +228,7 @@ namespace MG3TR
 
         m_znear = deserialiser.DeserialiseFloat(Constants::k_znear_attribute);
         m_zfar = deserialiser.DeserialiseFloat(Constants::k_zfar_attribute);
+
+        m_is_frustum_dirty = true;
     }
 }
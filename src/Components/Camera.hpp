@@ -2,10 +2,14 @@
 #define MG3TR_SRC_COMPONENTS_CAMERA_HPP_INCLUDED
 
 #include <Components/Component.hpp>
+#include <Graphics/CameraUniformBlock.hpp>
+#include <Graphics/UniformBuffer.hpp>
 
+#include <Math/Frustum.hpp>
 #include <Math/Vector3.hpp>
 #include <Math/Matrix4x4.hpp>
 
+#include <cstdint>
 #include <memory>
 
 namespace MG3TR
@@ -35,6 +39,13 @@ namespace MG3TR
         float m_znear;
         float m_zfar;
 
+        // Shared with the draw materials and frame packets that use it.
+        std::shared_ptr<UniformBuffer> m_uniform_buffer;
+
+        Frustum m_frustum;
+        std::uint32_t m_frustum_transform_version;
+        bool m_is_frustum_dirty;
+
     public:
         Camera(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform);
 
@@ -66,6 +77,20 @@ namespace MG3TR
         float GetZnear() const;
         float GetZfar() const;
 
+        // World space view volume, rebuilt only after the camera moved or its projection changed.
+        const Frustum& GetFrustum();
+
+        // Built from the current world transform, on the thread that runs the scene.
+        CameraUniformBlock CreateUniformBlock() const;
+
+        // The thread that renders uploads the block captured for the frame it draws to this buffer.
+        std::shared_ptr<const UniformBuffer> GetUniformBuffer() const;
+
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
+        // Hands the camera block of the frame to the render queue. The scene calls it for every camera
+        // once every transform is final.
+        void SubmitToRenderQueue() const;
+
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
     };
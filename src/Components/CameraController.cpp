@@ -29,6 +29,13 @@ namespace MG3TR
 
     }
 
+    TUpdatePhaseMask CameraController::GetUpdatePhases() const
+    {
+        const auto phases = static_cast<TUpdatePhaseMask>(GetUpdatePhaseBit(UpdatePhase::ParseInput)
+                                                          | GetUpdatePhaseBit(UpdatePhase::FrameUpdate));
+        return phases;
+    }
+
     void CameraController::Initialize() 
     {
         Vector3 euler_angles = GetTransform().lock()->GetWorldRotation().EulerAngles();
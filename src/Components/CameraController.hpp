@@ -46,6 +46,7 @@ namespace MG3TR
         CameraController& operator=(const CameraController &) = delete;
         CameraController& operator=(CameraController &&) = default;
 
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
         virtual void Initialize() override;
         virtual void ParseInput(const Input &input) override;
         virtual void FrameUpdate(const float delta_time) override;
@@ -1,5 +1,6 @@
 #include "Component.hpp"
 
+#include <Scene/Scene.hpp>
 #include <Scripting/GameObject.hpp>
 #include <Scripting/Transform.hpp>
 #include <Window/Input.hpp>
@@ -49,7 +50,25 @@ namespace MG3TR
 
     void Component::SetUID(TUID uid)
     {
+        const TUID previous_uid = m_uid;
         m_uid = uid;
+
+        const auto game_object = m_game_object.lock();
+        Scene *const scene = (game_object != nullptr) ? game_object->GetScene() : nullptr;
+        if (scene != nullptr)
+        {
+            scene->OnComponentUIDChanged(*this, previous_uid);
+        }
+    }
+
+    TUpdatePhaseMask Component::GetUpdatePhases() const
+    {
+        return k_all_update_phases;
+    }
+
+    bool Component::IsFrameUpdateThreadSafe() const
+    {
+        return false;
     }
 
     void Component::Initialize()
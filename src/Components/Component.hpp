@@ -1,6 +1,7 @@
 #ifndef MG3TR_SRC_COMPONENTS_COMPONENT_HPP_INCLUDED
 #define MG3TR_SRC_COMPONENTS_COMPONENT_HPP_INCLUDED
 
+#include <Components/UpdatePhase.hpp>
 #include <Scene/ILateBindable.hpp>
 #include <Serialisation/ISerialisable.hpp>
 #include <Utils/UIDGenerator.hpp>
@@ -45,6 +46,15 @@ namespace MG3TR
         void SetUID(TUID uid);
 
     public:
+        // The phases below that the component overrides. The scene only calls the component in these,
+        // so overriding a phase without listing it here means it is never called.
+        virtual TUpdatePhaseMask GetUpdatePhases() const;
+
+        // Thread safe components have their FrameUpdate run in parallel with each other, before the
+        // FrameUpdate of the other components. It may then read any transform but only change the component
+        // itself: moving or reparenting a transform throws, and components must not be added or removed.
+        virtual bool IsFrameUpdateThreadSafe() const;
+
         virtual void Initialize();
 
         virtual void ParseInput([[maybe_unused]] const Input &input);
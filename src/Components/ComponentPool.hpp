@@ -0,0 +1,146 @@
+#ifndef MG3TR_SRC_COMPONENTS_COMPONENTPOOL_HPP_INCLUDED
+#define MG3TR_SRC_COMPONENTS_COMPONENTPOOL_HPP_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace MG3TR
+{
+    // Storage for every component of one type, kept in fixed size blocks so that components of the
+    // same type sit next to each other in memory and keep their address for their whole lifetime.
+    //
+    // Components are still handed out as shared pointers, which return their slot to the pool once the
+    // last owner releases them. Slots freed this way are reused before new blocks are allocated. Each
+    // component also keeps the pool alive, so components released after exit are still destroyed safely.
+    template<typename ComponentClass>
+    class ComponentPool : public std::enable_shared_from_this<ComponentPool<ComponentClass>>
+    {
+    private:
+        static constexpr std::size_t k_block_size = 64;
+
+        struct Block
+        {
+            alignas(ComponentClass) std::byte m_storage[sizeof(ComponentClass) * k_block_size];
+        };
+
+        std::vector<std::unique_ptr<Block>> m_blocks;
+        std::vector<std::size_t> m_free_slots;
+
+        static std::shared_ptr<ComponentPool> m_instance;
+
+        ComponentPool();
+
+    public:
+        ~ComponentPool() = default;
+
+        ComponentPool(const ComponentPool &) = delete;
+        ComponentPool(ComponentPool &&) = delete;
+
+        ComponentPool& operator=(const ComponentPool &) = delete;
+        ComponentPool& operator=(ComponentPool &&) = delete;
+
+        static ComponentPool& GetInstance();
+
+        template<typename... Arguments>
+        std::shared_ptr<ComponentClass> Create(Arguments&&... arguments);
+
+    private:
+        ComponentClass* GetSlotAddress(const std::size_t slot);
+        std::size_t AcquireSlot();
+        void Destroy(const std::size_t slot);
+    };
+
+    template<typename ComponentClass>
+    std::shared_ptr<ComponentPool<ComponentClass>> ComponentPool<ComponentClass>::m_instance(new ComponentPool<ComponentClass>());
+
+    template<typename ComponentClass>
+    ComponentPool<ComponentClass>::ComponentPool()
+        : m_blocks(),
+          m_free_slots()
+    {
+
+    }
+
+    template<typename ComponentClass>
+    ComponentPool<ComponentClass>& ComponentPool<ComponentClass>::GetInstance()
+    {
+        return *m_instance;
+    }
+
+    template<typename ComponentClass>
+    template<typename... Arguments>
+    std::shared_ptr<ComponentClass> ComponentPool<ComponentClass>::Create(Arguments&&... arguments)
+    {
+        const std::size_t slot = AcquireSlot();
+
+        ComponentClass *component = nullptr;
+        try
+        {
+            component = ::new (static_cast<void*>(GetSlotAddress(slot))) ComponentClass(std::forward<Arguments>(arguments)...);
+        }
+        catch (...)
+        {
+            m_free_slots.push_back(slot);
+            throw;
+        }
+
+        auto ptr = std::shared_ptr<ComponentClass>(component, [pool = this->shared_from_this(), slot](ComponentClass *)
+        {
+            pool->Destroy(slot);
+        });
+        return ptr;
+    }
+
+    template<typename ComponentClass>
+    ComponentClass* ComponentPool<ComponentClass>::GetSlotAddress(const std::size_t slot)
+    {
+        Block &block = *m_blocks[slot / k_block_size];
+        std::byte *const address = block.m_storage + ((slot % k_block_size) * sizeof(ComponentClass));
+
+        auto component = std::launder(reinterpret_cast<ComponentClass*>(address));
+        return component;
+    }
+
+    template<typename ComponentClass>
+    std::size_t ComponentPool<ComponentClass>::AcquireSlot()
+    {
+        if (m_free_slots.empty())
+        {
+            const std::size_t first_slot = m_blocks.size() * k_block_size;
+
+            m_blocks.push_back(std::make_unique<Block>());
+
+            // Reversed, so that slots are handed out in storage order.
+            for (std::size_t i = k_block_size; i > 0; --i)
+            {
+                m_free_slots.push_back(first_slot + i - 1U);
+            }
+        }
+
+        const std::size_t slot = m_free_slots.back();
+        m_free_slots.pop_back();
+
+        return slot;
+    }
+
+    template<typename ComponentClass>
+    void ComponentPool<ComponentClass>::Destroy(const std::size_t slot)
+    {
+        GetSlotAddress(slot)->~ComponentClass();
+
+        m_free_slots.push_back(slot);
+    }
+
+    // Creates a component of the given type in the pool of that type.
+    template<typename ComponentClass, typename... Arguments>
+    std::shared_ptr<ComponentClass> CreateComponent(Arguments&&... arguments)
+    {
+        auto component = ComponentPool<ComponentClass>::GetInstance().Create(std::forward<Arguments>(arguments)...);
+        return component;
+    }
+}
+
+#endif // MG3TR_SRC_COMPONENTS_COMPONENTPOOL_HPP_INCLUDED
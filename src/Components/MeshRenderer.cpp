@@ -5,12 +5,13 @@
 #include <Constants/ShaderConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/MathConstants.hpp>
-#include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/FrustumCuller.hpp>
 #include <Graphics/Mesh.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Graphics/Shader.hpp>
 #include <Graphics/ShaderType.hpp>
+#include <Graphics/SubMesh.hpp>
 #include <Math/Math.hxx>
-#include <Math/Frustum.hpp>
 #include <Math/Matrix4x4.hpp>
 #include <Math/Vector3.hpp>
 #include <Math/Vector4.hpp>
@@ -22,31 +23,11 @@
 #include <Utils/ExceptionWithStacktrace.hpp>
 #include <Utils/TryCathRethrowStacktrace.hpp>
 
-static MG3TR::Sphere CalculateMeshBoundingSphereRadiusInWorldSpace(const MG3TR::Mesh &mesh)
-{
-    MG3TR::Vector3 min_coordinates;
-    MG3TR::Vector3 max_coordinates;
-
-    for (const auto &mesh : mesh.GetSubmeshes())
-    {
-        for (auto vertex : mesh.GetVertices())
-        {
-            min_coordinates = MG3TR::Vector3::Min(min_coordinates, vertex);
-            max_coordinates = MG3TR::Vector3::Max(max_coordinates, vertex);
-        }
-    }
+#include <utility>
 
-    const MG3TR::Vector3 center = MG3TR::Vector3::Lerp(max_coordinates, min_coordinates, 0.5F);
-    const float radius = (max_coordinates - min_coordinates).Magnitude() * 0.5F;
-    const MG3TR::Sphere sphere(center, radius);
-
-    return sphere;
-}
-
-static bool IsObjectInsideCameraFrustum(const MG3TR::Camera &camera, const MG3TR::Transform &object_transform,
-                                        const MG3TR::Sphere &bounding_sphere)
+static MG3TR::Sphere TransformBoundingSphereToWorldSpace(const MG3TR::Transform &object_transform,
+                                                        const MG3TR::Sphere &bounding_sphere)
 {
-    const MG3TR::Frustum camera_frustum(camera);
     const MG3TR::Vector3 object_scale = object_transform.GetWorldScale();
     const float max_scale = MG3TR::Math::Max(object_scale.x(), object_scale.y(), object_scale.z());
 
@@ -54,20 +35,15 @@ static bool IsObjectInsideCameraFrustum(const MG3TR::Camera &camera, const MG3TR
     const float object_radius = bounding_sphere.GetRadius() * max_scale;
 
     const MG3TR::Sphere world_space_sphere(object_center, object_radius);
-    const bool result = world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetLeftFace())
-           && world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetRightFace())
-           && world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetFarFace())
-           && world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetNearFace())
-           && world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetTopFace())
-           && world_space_sphere.IsOnOrInFrontOfPlane(camera_frustum.GetBottomFace());
-
-    return result;
+    return world_space_sphere;
 }
 
 namespace MG3TR
 {
     MeshRenderer::MeshRenderer(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform)
-        : Component(game_object, transform)
+        : Component(game_object, transform),
+          m_culling_proxies(),
+          m_culling_transform_version(0)
     {
 
     }
@@ -76,40 +52,73 @@ namespace MG3TR
                                const std::shared_ptr<Mesh> &mesh, const std::shared_ptr<Shader> &shader,
                                const std::weak_ptr<Camera> &camera, const bool use_frustum_culling)
         : Component(game_object, transform),
-          m_mesh_bounding_sphere({}, 0.0F)
+          m_mesh_bounding_sphere({}, 0.0F),
+          m_culling_proxies(),
+          m_culling_transform_version(0)
     {
         Construct(game_object, transform, mesh, shader, camera, use_frustum_culling);
     }
 
+    MeshRenderer::~MeshRenderer()
+    {
+        RemoveCullingProxies();
+    }
+
     Sphere MeshRenderer::GetBoundingSphere() const
     {
         return m_mesh_bounding_sphere;
     }
 
-    void MeshRenderer::FrameEnd([[maybe_unused]] float delta_time)
+    TUpdatePhaseMask MeshRenderer::GetUpdatePhases() const
+    {
+        return k_no_update_phases;
+    }
+
+    void MeshRenderer::SubmitToRenderQueue()
     {
         if (m_use_frustum_culling)
         {
-            const bool is_visible_by_camera = IsObjectInsideCameraFrustum(*m_camera.lock(), *GetTransform().lock(), m_mesh_bounding_sphere);
+            UpdateCullingProxies();
 
-            if (is_visible_by_camera)
+            for (const TBVHProxy proxy : m_culling_proxies)
             {
-                return;
+                FrustumCuller::GetInstance().Submit(proxy);
             }
         }
-
-        m_shader->Use();
-        m_shader->SetUniforms();
-        m_shader->BindAdditionals();
-
-        for (const auto &submesh : m_mesh->GetSubmeshes())
+        else
         {
-            auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+            SubmitDraws();
+        }
+    }
 
-            api.DrawSubMesh(submesh);
+    void MeshRenderer::SubmitDraws()
+    {
+        for (std::size_t i = 0; i < m_mesh->GetSubmeshes().size(); ++i)
+        {
+            SubmitDraw(i);
         }
     }
 
+    void MeshRenderer::SubmitDraw(const std::size_t submesh_index)
+    {
+        auto& render_queue = RenderQueue::GetInstance();
+        const auto camera = m_camera.lock();
+        const auto camera_transform = camera->GetTransform().lock();
+        const auto transform = GetTransform().lock();
+
+        const Vector3 to_object = transform->GetWorldPosition() - camera_transform->GetWorldPosition();
+        const float view_depth = Vector3::Dot(to_object, camera_transform->GetForwards());
+        const float normalised_depth = view_depth / camera->GetZfar();
+
+        const std::shared_ptr<const DrawMaterial> &material = m_shader->GetDrawMaterial();
+        auto submesh = m_mesh->GetSharedSubmesh(submesh_index);
+        const std::uint64_t sort_key = RenderQueue::CreateSortKey(m_shader->GetRenderPass(), material->m_program_id,
+                                                                  material->m_texture_id, submesh->GetVAO(),
+                                                                  normalised_depth);
+
+        render_queue.Submit(DrawPacket{ sort_key, material, std::move(submesh), transform->GetWorldModelMatrix() });
+    }
+
     void MeshRenderer::Serialise(ISerialiser &serialiser)
     {
         namespace Constants = MeshRendererSerialisationConstants;
@@ -147,7 +156,9 @@ namespace MG3TR
         m_mesh->Deserialise(deserialiser);
         deserialiser.EndDeserialisingLastChild();
 
-        m_mesh_bounding_sphere = CalculateMeshBoundingSphereRadiusInWorldSpace(*m_mesh);
+        m_mesh_bounding_sphere = m_mesh->GetBoundingSphere();
+        RemoveCullingProxies();
+
         m_camera_uid = deserialiser.DeserialiseUnsigned(Constants::k_camera_uid_attribute);
         m_use_frustum_culling = deserialiser.DeserialiseBool(Constants::k_use_frustum_culling_attribute);
 
@@ -174,6 +185,7 @@ namespace MG3TR
                                           + " for MeshRenderer script");
         }
         m_camera = found_camera;
+        RemoveCullingProxies();
 
         m_shader->LateBind(scene);
     }
@@ -196,7 +208,48 @@ namespace MG3TR
 
         if (mesh != nullptr)
         {
-            m_mesh_bounding_sphere = CalculateMeshBoundingSphereRadiusInWorldSpace(*mesh);
+            m_mesh_bounding_sphere = mesh->GetBoundingSphere();
+        }
+    }
+
+    // Every submesh is culled on its own, so that only the visible parts of large meshes are drawn.
+    // The world version changes whenever this transform or one of its parents moves.
+    void MeshRenderer::UpdateCullingProxies()
+    {
+        auto& culler = FrustumCuller::GetInstance();
+        const auto transform = GetTransform().lock();
+        const std::uint32_t transform_version = transform->GetWorldVersion();
+        const std::vector<SubMesh> &submeshes = m_mesh->GetSubmeshes();
+
+        if (m_culling_proxies.empty())
+        {
+            for (std::size_t i = 0; i < submeshes.size(); ++i)
+            {
+                const Sphere world_space_sphere = TransformBoundingSphereToWorldSpace(*transform, submeshes[i].GetBoundingSphere());
+                m_culling_proxies.push_back(culler.Add(*this, i, m_camera, world_space_sphere));
+            }
+
+            m_culling_transform_version = transform_version;
         }
+        else if (transform_version != m_culling_transform_version)
+        {
+            for (std::size_t i = 0; i < submeshes.size(); ++i)
+            {
+                const Sphere world_space_sphere = TransformBoundingSphereToWorldSpace(*transform, submeshes[i].GetBoundingSphere());
+                culler.Move(m_culling_proxies[i], world_space_sphere);
+            }
+
+            m_culling_transform_version = transform_version;
+        }
+    }
+
+    void MeshRenderer::RemoveCullingProxies()
+    {
+        for (const TBVHProxy proxy : m_culling_proxies)
+        {
+            FrustumCuller::GetInstance().Remove(proxy);
+        }
+
+        m_culling_proxies.clear();
     }
 }
@@ -2,9 +2,13 @@
 #define MG3TR_SRC_COMPONENTS_MESHRENDERER_HPP_INCLUDED
 
 #include <Components/Component.hpp>
+#include <Math/BoundingVolumeHierarchy.hpp>
 #include <Math/Sphere.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace MG3TR
 {
@@ -22,23 +26,34 @@ namespace MG3TR
         bool m_use_frustum_culling;
         TUID m_camera_uid;
 
+        // Proxies of the world space bounding spheres of the submeshes in the FrustumCuller, added on the
+        // first culled frame.
+        std::vector<TBVHProxy> m_culling_proxies;
+        std::uint32_t m_culling_transform_version;
+
     public:
         MeshRenderer(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform);
 
         MeshRenderer(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform,
                      const std::shared_ptr<Mesh> &mesh, const std::shared_ptr<Shader> &shader,
                      const std::weak_ptr<Camera> &camera, const bool use_frustum_culling = true);
-        virtual ~MeshRenderer() = default;
+        virtual ~MeshRenderer();
 
         MeshRenderer(const MeshRenderer &) = delete;
-        MeshRenderer(MeshRenderer &&) = default;
+        MeshRenderer(MeshRenderer &&) = delete;
         
         MeshRenderer& operator=(const MeshRenderer &) = delete;
-        MeshRenderer& operator=(MeshRenderer &&) = default;
+        MeshRenderer& operator=(MeshRenderer &&) = delete;
 
         Sphere GetBoundingSphere() const;
 
-        virtual void FrameEnd([[maybe_unused]] const float delta_time) override;
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
+
+        // Called by the scene for every mesh renderer once every transform is final. With frustum
+        // culling, the draws are submitted later by the FrustumCuller if the mesh is visible.
+        void SubmitToRenderQueue();
+        void SubmitDraws();
+        void SubmitDraw(const std::size_t submesh_index);
 
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
@@ -48,6 +63,9 @@ namespace MG3TR
         void Construct(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform,
                        const std::shared_ptr<Mesh> &mesh, const std::shared_ptr<Shader> &shader,
                        const std::weak_ptr<Camera> &camera, const bool use_frustum_culling);
+
+        void UpdateCullingProxies();
+        void RemoveCullingProxies();
     };
 }
 
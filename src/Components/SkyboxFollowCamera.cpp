@@ -28,6 +28,11 @@ namespace MG3TR
         }
     }
     
+    TUpdatePhaseMask SkyboxFollowCamera::GetUpdatePhases() const
+    {
+        return GetUpdatePhaseBit(UpdatePhase::FrameUpdate);
+    }
+
     void SkyboxFollowCamera::FrameUpdate([[maybe_unused]] float delta_time)
     {
         const auto camera_world_position = m_camera.lock()->GetWorldPosition();
@@ -26,6 +26,7 @@ namespace MG3TR
         SkyboxFollowCamera& operator=(const SkyboxFollowCamera &) = delete;
         SkyboxFollowCamera& operator=(SkyboxFollowCamera &&) = default;
 
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
         virtual void FrameUpdate(float delta_time) override;
 
         virtual void Serialise(ISerialiser &serialiser) override;
@@ -18,6 +18,11 @@ namespace MG3TR
 
     }
     
+    TUpdatePhaseMask TestMovement::GetUpdatePhases() const
+    {
+        return GetUpdatePhaseBit(UpdatePhase::FrameUpdate);
+    }
+
     void TestMovement::Initialize()
     {
         m_initial_local_position = GetTransform().lock()->GetLocalPosition();
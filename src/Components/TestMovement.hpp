@@ -25,6 +25,7 @@ namespace MG3TR
         TestMovement& operator=(const TestMovement &) = delete;
         TestMovement& operator=(TestMovement &&) = default;
 
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
         virtual void Initialize() override;
         virtual void FrameUpdate(const float delta_time) override;
 
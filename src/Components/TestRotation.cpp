@@ -17,6 +17,11 @@ namespace MG3TR
 
     }
     
+    TUpdatePhaseMask TestRotation::GetUpdatePhases() const
+    {
+        return GetUpdatePhaseBit(UpdatePhase::FrameUpdate);
+    }
+
     void TestRotation::FrameUpdate(const float delta_time)
     {
         auto transform = GetTransform().lock();
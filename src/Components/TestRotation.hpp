@@ -17,6 +17,7 @@ namespace MG3TR
         TestRotation& operator=(const TestRotation &) = delete;
         TestRotation& operator=(TestRotation &&) = default;
 
+        virtual TUpdatePhaseMask GetUpdatePhases() const override;
         virtual void FrameUpdate(const float delta_time) override;
 
         virtual void Serialise(ISerialiser &serialiser) override;
@@ -0,0 +1,32 @@
+#ifndef MG3TR_SRC_COMPONENTS_UPDATEPHASE_HPP_INCLUDED
+#define MG3TR_SRC_COMPONENTS_UPDATEPHASE_HPP_INCLUDED
+
+#include <cstddef>
+
+namespace MG3TR
+{
+    // Per frame phases of the components, in the order the scene runs them.
+    enum class UpdatePhase : unsigned char
+    {
+        ParseInput = 0,
+        FrameStart = 1,
+        FrameUpdate = 2,
+        FrameEnd = 3
+    };
+
+    constexpr std::size_t k_update_phase_count = 4;
+
+    // One bit per UpdatePhase.
+    using TUpdatePhaseMask = unsigned char;
+
+    constexpr TUpdatePhaseMask k_no_update_phases = 0U;
+    constexpr TUpdatePhaseMask k_all_update_phases = (1U << k_update_phase_count) - 1U;
+
+    constexpr TUpdatePhaseMask GetUpdatePhaseBit(const UpdatePhase phase)
+    {
+        const auto bit = static_cast<TUpdatePhaseMask>(1U << static_cast<unsigned>(phase));
+        return bit;
+    }
+}
+
+#endif // MG3TR_SRC_COMPONENTS_UPDATEPHASE_HPP_INCLUDED
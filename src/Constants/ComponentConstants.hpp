@@ -4,6 +4,7 @@
 #include <Components/ComponentType.hpp>
 #include <Components/Camera.hpp>
 #include <Components/CameraController.hpp>
+#include <Components/ComponentPool.hpp>
 #include <Components/MeshRenderer.hpp>
 #include <Components/SkyboxFollowCamera.hpp>
 #include <Components/TestMovement.hpp>
@@ -29,7 +30,7 @@ namespace MG3TR::ComponentConstants
     template<typename ComponentType>
     std::shared_ptr<ComponentType> Construct(const std::weak_ptr<GameObject> &game_object, const std::weak_ptr<Transform> &transform)
     {
-        auto component = std::make_shared<ComponentType>(game_object, transform);
+        auto component = CreateComponent<ComponentType>(game_object, transform);
         return component;
     }
 
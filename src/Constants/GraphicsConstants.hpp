@@ -10,6 +10,15 @@ namespace MG3TR
         const unsigned k_vertices_location = 0;
         const unsigned k_normals_location = 1;
         const unsigned k_uvs_location = 2;
+        // The per-instance model matrix occupies this location and the next three.
+        const unsigned k_instance_model_location = 3;
+
+        // Compact vertex formats. Octahedral normals are decoded by the vertex shaders, which
+        // ShaderProgram enables with ShaderConstants::k_octahedral_normals_define.
+        const bool k_use_octahedral_normals = true;
+        const bool k_use_half_float_uvs = true;
+        // Used for submeshes whose vertices can all be addressed with 16 bits.
+        const bool k_use_16_bit_indices = true;
     }
 
     namespace SceneConstants
@@ -33,11 +42,14 @@ namespace MG3TR
         const std::string k_texture_and_lighting_fragment_shader(MG3TR_ROOT_DIR "res/Shaders/TextureAndLighting.frag");
     
         const std::string k_model_uniform_location("u_model");
-        const std::string k_view_uniform_location("u_view");
-        const std::string k_projection_uniform_location("u_projection");
-
-        const std::string k_camera_position_uniform_location("u_camera_position");
         const std::string k_light_position_uniform_location("u_light_position");
+
+        // Selects the variant of the vertex shaders that reads the model matrix from an instance attribute.
+        const std::string k_instanced_define("MG3TR_INSTANCED");
+        const std::string k_octahedral_normals_define("MG3TR_OCTAHEDRAL_NORMALS");
+
+        // Must match the binding of "CameraBlock" in the GLSL files.
+        const unsigned k_camera_uniform_block_binding = 0U;
     }
 }
 
@@ -10,35 +10,35 @@ namespace MG3TR
 {
     namespace Vector2Constants
     {
-        const Vector2 k_zero(  0.0F,  0.0F);
-        const Vector2 k_one(   1.0F,  1.0F);
-        const Vector2 k_up(    0.0F,  1.0F);
-        const Vector2 k_down(  0.0F, -1.0F);
-        const Vector2 k_left(  1.0F,  0.0F);
-        const Vector2 k_right(-1.0F,  0.0F);
+        constexpr Vector2 k_zero(  0.0F,  0.0F);
+        constexpr Vector2 k_one(   1.0F,  1.0F);
+        constexpr Vector2 k_up(    0.0F,  1.0F);
+        constexpr Vector2 k_down(  0.0F, -1.0F);
+        constexpr Vector2 k_left(  1.0F,  0.0F);
+        constexpr Vector2 k_right(-1.0F,  0.0F);
     }
 
     namespace Vector3Constants
     {
-        const Vector3 k_zero(      0.0F,  0.0F,  0.0F);
-        const Vector3 k_one(       1.0F,  1.0F,  1.0F);
-        const Vector3 k_up(        0.0F,  1.0F,  0.0F);
-        const Vector3 k_down(      0.0F, -1.0F,  0.0F);
-        const Vector3 k_left(      1.0F,  0.0F,  0.0F);
-        const Vector3 k_right(    -1.0F,  0.0F,  0.0F);
-        const Vector3 k_forwards(  0.0F,  0.0F,  1.0F);
-        const Vector3 k_backwards( 0.0F,  0.0F, -1.0F);
+        constexpr Vector3 k_zero(      0.0F,  0.0F,  0.0F);
+        constexpr Vector3 k_one(       1.0F,  1.0F,  1.0F);
+        constexpr Vector3 k_up(        0.0F,  1.0F,  0.0F);
+        constexpr Vector3 k_down(      0.0F, -1.0F,  0.0F);
+        constexpr Vector3 k_left(      1.0F,  0.0F,  0.0F);
+        constexpr Vector3 k_right(    -1.0F,  0.0F,  0.0F);
+        constexpr Vector3 k_forwards(  0.0F,  0.0F,  1.0F);
+        constexpr Vector3 k_backwards( 0.0F,  0.0F, -1.0F);
     }
 
     namespace Vector4Constants
     {
-        const Vector4 k_zero(0.0F,  0.0F,  0.0F, 0.0F);
-        const Vector4 k_one( 1.0F,  1.0F,  1.0F, 1.0F);
+        constexpr Vector4 k_zero(0.0F,  0.0F,  0.0F, 0.0F);
+        constexpr Vector4 k_one( 1.0F,  1.0F,  1.0F, 1.0F);
     }
 
     namespace QuaternionConstants
     {
-        const Quaternion k_identity(1.0F, 0.0F, 0.0F, 0.0F);
+        constexpr Quaternion k_identity(1.0F, 0.0F, 0.0F, 0.0F);
     }
 }
 
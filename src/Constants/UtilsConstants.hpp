@@ -4,6 +4,13 @@
 namespace MG3TR::UtilsConstants
 {
     const unsigned k_max_GL_errors_depth_to_print = 10U;
+    const unsigned k_GL_error_sampling_period = 64U;
+
+    // Levels of the transform hierarchy smaller than twice this are propagated on one thread.
+    const unsigned k_min_transforms_per_propagation_job = 4096U;
+
+    // Thread safe components whose FrameUpdate runs in one job.
+    const unsigned k_components_per_frame_update_job = 64U;
 }
 
 #endif // MG3TR_SRC_CONSTANTS_UTILSCONSTANTS_HPP_INCLUDED
@@ -0,0 +1,30 @@
+#ifndef MG3TR_SRC_GRAPHICS_API_GLVALIDATIONLEVEL_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_API_GLVALIDATIONLEVEL_HPP_INCLUDED
+
+// Highest validation level compiled in. CMake sets it from the build type; builds
+// without it fall back to NDEBUG. Level 0 removes every per-call check.
+#ifndef MG3TR_GL_VALIDATION_LEVEL
+#   ifdef NDEBUG
+#       define MG3TR_GL_VALIDATION_LEVEL 0
+#   else
+#       define MG3TR_GL_VALIDATION_LEVEL 2
+#   endif
+#endif
+
+namespace MG3TR
+{
+    enum class GLValidationLevel : unsigned char
+    {
+        // No error polling at all.
+        Off = 0,
+        // glGetError after one call out of UtilsConstants::k_GL_error_sampling_period.
+        Sampled = 1,
+        // GL_KHR_debug messages, reported with the file and line of the call that raised them.
+        // Falls back to polling after every call if the context does not support the extension.
+        DebugCallback = 2
+    };
+
+    constexpr GLValidationLevel k_max_GL_validation_level = static_cast<GLValidationLevel>(MG3TR_GL_VALIDATION_LEVEL);
+}
+
+#endif // MG3TR_SRC_GRAPHICS_API_GLVALIDATIONLEVEL_HPP_INCLUDED
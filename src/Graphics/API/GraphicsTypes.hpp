@@ -1,6 +1,8 @@
 #ifndef MG3TR_SRC_GRAPHICS_API_GRAPHICSTYPES_HPP_INCLUDED
 #define MG3TR_SRC_GRAPHICS_API_GRAPHICSTYPES_HPP_INCLUDED
 
+#include <cstddef>
+
 namespace MG3TR
 {
     using TTextureID = unsigned;
@@ -8,8 +10,20 @@ namespace MG3TR
     using TVAOID = unsigned;
     using TVBOID = unsigned;
     using TIBOID = unsigned;
+    using TUBOID = unsigned;
     using TShaderID = unsigned;
     using TShaderProgramID = unsigned;
+    using TUniformLocation = int;
+
+    const TUniformLocation k_invalid_uniform_location = -1;
+
+    // Calls that change pipeline state, split into the ones sent to the driver
+    // and the ones skipped because the requested state was already current.
+    struct StateChangeStatistics
+    {
+        std::size_t m_issued_calls;
+        std::size_t m_elided_calls;
+    };
 
     enum class GPUShaderType : unsigned char
     {
@@ -17,6 +31,12 @@ namespace MG3TR
         FragmentShader,
         GeometryShader
     };
+
+    enum class GPUIndexType : unsigned char
+    {
+        UInt16,
+        UInt32
+    };
 }
 
 #endif // MG3TR_SRC_GRAPHICS_API_GRAPHICSTYPES_HPP_INCLUDED
@@ -2,6 +2,8 @@
 #define MG3TR_SRC_GRAPHICS_API_IGRAPHICSAPI_HPP_INCLUDED
 
 #include "GraphicsTypes.hpp"
+#include "UniformHandle.hpp"
+#include "VertexLayout.hpp"
 
 #include <Math/Vector2.hpp>
 #include <Math/Vector3.hpp>
@@ -9,6 +11,7 @@
 #include <Math/Matrix4x4.hpp>
 
 #include <string>
+#include <vector>
 
 namespace MG3TR
 {
@@ -34,10 +37,10 @@ namespace MG3TR
         virtual void BindTexture(const TTextureID texture_id, const TTextureUnitID texture_unit_id) = 0;
 
         virtual TVAOID CreateVAO() = 0;
+        // Uploads interleaved vertices and points the attributes of the bound VAO at them.
         virtual TVBOID CreateVBO(const void *const data,
                                  const std::size_t memory_size,
-                                 const std::size_t vertex_size,
-                                 const unsigned location) = 0;
+                                 const VertexLayout &layout) = 0;
         virtual TIBOID CreateIBO(const void *const data,
                                  const std::size_t memory_size) = 0;
         
@@ -45,6 +48,11 @@ namespace MG3TR
         virtual void DeleteVBO(const TVBOID vbo) = 0;
         virtual void DeleteIBO(const TIBOID ibo) = 0;
 
+        virtual TUBOID CreateUBO(const std::size_t memory_size) = 0;
+        virtual void UpdateUBO(const TUBOID ubo, const void *const data, const std::size_t memory_size) = 0;
+        virtual void BindUBO(const TUBOID ubo, const unsigned binding_point) = 0;
+        virtual void DeleteUBO(const TUBOID ubo) = 0;
+
         virtual TShaderID CreateShader(const GPUShaderType type, const std::string &code, const std::string &path) = 0;
         virtual TShaderProgramID CreateShaderProgram(const TShaderID vertex_shader,
                                                      const TShaderID fragment_shader) = 0;
@@ -53,30 +61,30 @@ namespace MG3TR
                                                      const TShaderID fragment_shader) = 0;
         virtual void DeleteShader(const TShaderProgramID shader_program, const TShaderID shader) = 0;
         virtual void DeleteShaderProgram(const TShaderProgramID shader_program) = 0;
-        virtual void SetShaderUniformFloat(const TShaderProgramID shader_program,
-                                           const std::string &uniform_name,
-                                           const float uniform_value) = 0;
+        virtual std::vector<UniformDescription> GetActiveUniforms(const TShaderProgramID shader_program) = 0;
         virtual void UseShader(const TShaderProgramID shader_program) = 0;
-        virtual void SetShaderUniformInt(const TShaderProgramID shader_program,
-                                         const std::string &uniform_name,
+        virtual void SetShaderUniformFloat(const UniformHandle<float> uniform,
+                                           const float uniform_value) = 0;
+        virtual void SetShaderUniformInt(const UniformHandle<int> uniform,
                                          const int uniform_value) = 0;
-        virtual void SetShaderUniformUnsigned(const TShaderProgramID shader_program,
-                                              const std::string &uniform_name,
+        virtual void SetShaderUniformUnsigned(const UniformHandle<unsigned> uniform,
                                               const unsigned uniform_value) = 0;
-        virtual void SetShaderUniformVector2(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector2(const UniformHandle<Vector2> uniform,
                                              const Vector2 uniform_value) = 0;
-        virtual void SetShaderUniformVector3(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector3(const UniformHandle<Vector3> uniform,
                                              const Vector3 uniform_value) = 0;
-        virtual void SetShaderUniformVector4(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector4(const UniformHandle<Vector4> uniform,
                                              const Vector4 uniform_value) = 0;
-        virtual void SetShaderUniformMatrix4x4(const TShaderProgramID shader_program,
-                                               const std::string &uniform_name,
+        virtual void SetShaderUniformMatrix4x4(const UniformHandle<Matrix4x4> uniform,
                                                const Matrix4x4 uniform_value) = 0;
         
         virtual void DrawSubMesh(const SubMesh &submesh) = 0;
+        // Draws the submesh once per matrix. The matrices are read by the vertex shader as a
+        // per-instance attribute starting at MeshConstants::k_instance_model_location.
+        virtual void DrawSubMeshInstanced(const SubMesh &submesh, const std::vector<Matrix4x4> &model_matrices) = 0;
+
+        virtual StateChangeStatistics GetStateChangeStatistics() const = 0;
+        virtual void ResetStateChangeStatistics() = 0;
     };
 }
 
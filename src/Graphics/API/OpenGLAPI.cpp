@@ -2,16 +2,40 @@
 
 #include <glad/glad.h>
 
+#include <Constants/GraphicsConstants.hpp>
 #include <Constants/UtilsConstants.hpp>
 #include <Graphics/SubMesh.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <string>
 #include <vector>
 
 static const GLint k_internal_formats[] = { 0, GL_R8, GL_RG8, GL_RGB8, GL_RGBA8 };
 static const GLint k_pixel_format[] = { 0, GL_RED, GL_RG, GL_RGB, GL_RGBA };
 
+struct GLAttributeFormat
+{
+    GLint m_components;
+    GLenum m_type;
+    GLboolean m_is_normalised;
+};
+
+// Indexed by MG3TR::GPUAttributeFormat.
+static const GLAttributeFormat k_attribute_formats[] =
+{
+    { 2, GL_FLOAT, GL_FALSE },
+    { 3, GL_FLOAT, GL_FALSE },
+    { 2, GL_HALF_FLOAT, GL_FALSE },
+    { 2, GL_SHORT, GL_TRUE }
+};
+
+// Indexed by MG3TR::GPUIndexType.
+static const GLenum k_index_types[] = { GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+
+#if MG3TR_GL_VALIDATION_LEVEL > 0
+
 // https://codeyarns.com/tech/2015-09-14-how-to-check-error-in-opengl.html
 static const char* GetGLErrorString(const GLenum err)
 {
@@ -58,10 +82,109 @@ static void PrintGLErrors(const char* const file, const int line)
     }
 }
 
-#define PRINT_GL_ERRORS_IF_ANY() PrintGLErrors(__FILE__, __LINE__)
+static MG3TR::GLValidationLevel s_validation_level = MG3TR::k_max_GL_validation_level;
+static unsigned s_calls_since_error_check = 0U;
+static bool s_is_debug_output_enabled = false;
+static std::vector<std::string> s_pending_debug_messages;
+
+static void GLAPIENTRY QueueGLDebugMessage([[maybe_unused]] const GLenum source, [[maybe_unused]] const GLenum type,
+                                          [[maybe_unused]] const GLuint id, const GLenum severity,
+                                          const GLsizei length, const GLchar *const message,
+                                          [[maybe_unused]] const void *const user_parameter)
+{
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION)
+    {
+        return;
+    }
+
+    // Debug output is synchronous, so the message is printed by the check that follows the call raising it.
+    s_pending_debug_messages.emplace_back(message, static_cast<std::size_t>(length));
+}
+
+static void PrintGLDebugMessages(const char* const file, const int line)
+{
+    for (const auto &message : s_pending_debug_messages)
+    {
+        std::cerr << "OpenGL debug message: " << message << "\tin " << file << ":" << line << std::endl;
+    }
+
+    s_pending_debug_messages.clear();
+}
+
+static void ValidateGLCall(const char* const file, const int line)
+{
+    switch (s_validation_level)
+    {
+        case MG3TR::GLValidationLevel::Off:
+        {
+            break;
+        }
+        case MG3TR::GLValidationLevel::Sampled:
+        {
+            ++s_calls_since_error_check;
+            if (s_calls_since_error_check >= MG3TR::UtilsConstants::k_GL_error_sampling_period)
+            {
+                s_calls_since_error_check = 0U;
+                PrintGLErrors(file, line);
+            }
+            break;
+        }
+        case MG3TR::GLValidationLevel::DebugCallback:
+        {
+            if (s_is_debug_output_enabled)
+            {
+                PrintGLDebugMessages(file, line);
+            }
+            else
+            {
+                PrintGLErrors(file, line);
+            }
+            break;
+        }
+    }
+}
+
+#   define PRINT_GL_ERRORS_IF_ANY() ValidateGLCall(__FILE__, __LINE__)
+#else
+#   define PRINT_GL_ERRORS_IF_ANY() ((void)0)
+#endif
+
+static MG3TR::GPUUniformType ConvertGLTypeToUniformType(const GLenum gl_type)
+{
+    switch (gl_type)
+    {
+        case GL_FLOAT:        return MG3TR::GPUUniformType::Float;
+        case GL_INT:          return MG3TR::GPUUniformType::Int;
+        case GL_UNSIGNED_INT: return MG3TR::GPUUniformType::Unsigned;
+        case GL_FLOAT_VEC2:   return MG3TR::GPUUniformType::Vector2;
+        case GL_FLOAT_VEC3:   return MG3TR::GPUUniformType::Vector3;
+        case GL_FLOAT_VEC4:   return MG3TR::GPUUniformType::Vector4;
+        case GL_FLOAT_MAT4:   return MG3TR::GPUUniformType::Matrix4x4;
+        case GL_SAMPLER_2D:   return MG3TR::GPUUniformType::Sampler;
+        case GL_SAMPLER_CUBE: return MG3TR::GPUUniformType::Sampler;
+    }
+    return MG3TR::GPUUniformType::Unsupported;
+}
 
 namespace MG3TR
 {
+    // The shadowed values match the initial state of a new GL context.
+    OpenGLAPI::OpenGLAPI()
+        : m_bound_program(0),
+          m_bound_vao(0),
+          m_active_texture_unit(0),
+          m_bound_textures{},
+          m_bound_uniform_buffers{},
+          m_is_depth_test_enabled(false),
+          m_is_back_face_culling_enabled(false),
+          m_statistics{},
+          m_instance_buffer(0),
+          m_instance_buffer_size(0),
+          m_instanced_vaos()
+    {
+
+    }
+
     void OpenGLAPI::Initialise(void *const load_process)
     {
     const GLenum ret = gladLoadGLLoader(reinterpret_cast<GLADloadproc>(load_process));
@@ -76,15 +199,70 @@ namespace MG3TR
     glDepthFunc(GL_LESS);
     glEnable(GL_CULL_FACE);  
     glCullFace(GL_BACK);
+
+    m_is_depth_test_enabled = true;
+    m_is_back_face_culling_enabled = true;
+
+    SetValidationLevel(GetValidationLevel());
+    }
+
+    void OpenGLAPI::SetValidationLevel([[maybe_unused]] const GLValidationLevel level)
+    {
+#       if MG3TR_GL_VALIDATION_LEVEL > 0
+            s_validation_level = std::min(level, k_max_GL_validation_level);
+            s_calls_since_error_check = 0U;
+
+            // glad leaves the pointer empty when neither GL 4.3 nor GL_KHR_debug is available.
+            const bool is_debug_output_supported = (glDebugMessageCallback != nullptr);
+            const bool enable_debug_output = is_debug_output_supported
+                                             && (s_validation_level == GLValidationLevel::DebugCallback);
+
+            if (enable_debug_output && !s_is_debug_output_enabled)
+            {
+                glEnable(GL_DEBUG_OUTPUT);
+                glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+                glDebugMessageCallback(QueueGLDebugMessage, nullptr);
+            }
+            else if (!enable_debug_output && s_is_debug_output_enabled)
+            {
+                glDisable(GL_DEBUG_OUTPUT);
+            }
+
+            s_is_debug_output_enabled = enable_debug_output;
+#       endif
+    }
+
+    GLValidationLevel OpenGLAPI::GetValidationLevel() const
+    {
+#       if MG3TR_GL_VALIDATION_LEVEL > 0
+            return s_validation_level;
+#       else
+            return GLValidationLevel::Off;
+#       endif
     }
 
     void OpenGLAPI::Finalise()
     {
-        
+        if (m_instance_buffer > 0)
+        {
+            DeleteVBO(m_instance_buffer);
+
+            m_instance_buffer = 0;
+            m_instance_buffer_size = 0;
+        }
+
+        m_instanced_vaos.clear();
     }
 
     void OpenGLAPI::SetDepthTest(const bool enable)
     {
+        if (ElideIfRedundant(enable == m_is_depth_test_enabled))
+        {
+            return;
+        }
+
+        m_is_depth_test_enabled = enable;
+
         if (enable)
         {
             glEnable(GL_DEPTH_TEST);
@@ -98,6 +276,13 @@ namespace MG3TR
 
     void OpenGLAPI::SetBackFaceCulling(const bool enable)
     {
+        if (ElideIfRedundant(enable == m_is_back_face_culling_enabled))
+        {
+            return;
+        }
+
+        m_is_back_face_culling_enabled = enable;
+
         if (enable)
         {
             glEnable(GL_CULL_FACE);  
@@ -158,6 +343,11 @@ namespace MG3TR
         glBindTexture(GL_TEXTURE_2D, 0);
         PRINT_GL_ERRORS_IF_ANY();
 
+        if (m_active_texture_unit < k_cached_texture_units)
+        {
+            m_bound_textures[m_active_texture_unit] = 0;
+        }
+
         TTextureID texture_id = static_cast<TTextureID>(id);
         return texture_id;
     }
@@ -166,15 +356,34 @@ namespace MG3TR
     {
         glDeleteTextures(1, &texture_id);
         PRINT_GL_ERRORS_IF_ANY();
+
+        // GL unbinds deleted textures, and their names may be reused.
+        std::replace(m_bound_textures.begin(), m_bound_textures.end(), texture_id, TTextureID{0});
     }
 
     void OpenGLAPI::BindTexture(const TTextureID texture_id, const TTextureUnitID texture_unit_id)
     {
-        glActiveTexture(GL_TEXTURE0 + texture_unit_id);
-        PRINT_GL_ERRORS_IF_ANY();
+        const bool is_unit_cached = (texture_unit_id < k_cached_texture_units);
+        if (ElideIfRedundant(is_unit_cached && (m_bound_textures[texture_unit_id] == texture_id)))
+        {
+            return;
+        }
+
+        if (!ElideIfRedundant(texture_unit_id == m_active_texture_unit))
+        {
+            glActiveTexture(GL_TEXTURE0 + texture_unit_id);
+            PRINT_GL_ERRORS_IF_ANY();
+
+            m_active_texture_unit = texture_unit_id;
+        }
 
         glBindTexture(GL_TEXTURE_2D, texture_id);
         PRINT_GL_ERRORS_IF_ANY();
+
+        if (is_unit_cached)
+        {
+            m_bound_textures[texture_unit_id] = texture_id;
+        }
     }
 
     TVAOID OpenGLAPI::CreateVAO()
@@ -186,6 +395,8 @@ namespace MG3TR
         glBindVertexArray(vao);
         PRINT_GL_ERRORS_IF_ANY();
 
+        m_bound_vao = vao;
+
         const TVAOID vao_id = static_cast<TVAOID>(vao);
 
         return vao_id;
@@ -193,8 +404,7 @@ namespace MG3TR
 
     TVBOID OpenGLAPI::CreateVBO(const void *const data,
                                 const std::size_t memory_size,
-                                const std::size_t vertex_size,
-                                const unsigned location)
+                                const VertexLayout &layout)
     {
         if (memory_size == 0)
         {
@@ -212,14 +422,20 @@ namespace MG3TR
         glBufferData(GL_ARRAY_BUFFER, memory_size, data, GL_STATIC_DRAW);
         PRINT_GL_ERRORS_IF_ANY();
 
-        glEnableVertexAttribArray(location);
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
 
-        glVertexAttribPointer(location, vertex_size, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(0), nullptr);
-        PRINT_GL_ERRORS_IF_ANY();
+        for (const auto &attribute : layout.GetAttributes())
+        {
+            const GLAttributeFormat &format = k_attribute_formats[static_cast<std::size_t>(attribute.m_format)];
+            const void *const offset = reinterpret_cast<const void*>(attribute.m_offset);
 
-        glEnableVertexAttribArray(0);
-        PRINT_GL_ERRORS_IF_ANY();
+            glEnableVertexAttribArray(attribute.m_location);
+            PRINT_GL_ERRORS_IF_ANY();
+
+            glVertexAttribPointer(attribute.m_location, format.m_components, format.m_type, format.m_is_normalised,
+                                  stride, offset);
+            PRINT_GL_ERRORS_IF_ANY();
+        }
 
         const TVAOID vbo_id = static_cast<TVBOID>(vbo);
 
@@ -254,6 +470,13 @@ namespace MG3TR
     {
         glDeleteVertexArrays(1, &vao);
         PRINT_GL_ERRORS_IF_ANY();
+
+        if (m_bound_vao == vao)
+        {
+            m_bound_vao = 0;
+        }
+
+        (void)m_instanced_vaos.erase(vao);
     }
 
     void OpenGLAPI::DeleteVBO(const TVBOID vbo)
@@ -268,6 +491,58 @@ namespace MG3TR
         PRINT_GL_ERRORS_IF_ANY();
     }
 
+    TUBOID OpenGLAPI::CreateUBO(const std::size_t memory_size)
+    {
+        GLuint ubo = 0;
+
+        glGenBuffers(1, &ubo);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        glBufferData(GL_UNIFORM_BUFFER, memory_size, nullptr, GL_DYNAMIC_DRAW);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        const TUBOID ubo_id = static_cast<TUBOID>(ubo);
+
+        return ubo_id;
+    }
+
+    void OpenGLAPI::UpdateUBO(const TUBOID ubo, const void *const data, const std::size_t memory_size)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, memory_size, data);
+        PRINT_GL_ERRORS_IF_ANY();
+    }
+
+    void OpenGLAPI::BindUBO(const TUBOID ubo, const unsigned binding_point)
+    {
+        const bool is_binding_cached = (binding_point < k_cached_uniform_buffer_bindings);
+        if (ElideIfRedundant(is_binding_cached && (m_bound_uniform_buffers[binding_point] == ubo)))
+        {
+            return;
+        }
+
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding_point, ubo);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        if (is_binding_cached)
+        {
+            m_bound_uniform_buffers[binding_point] = ubo;
+        }
+    }
+
+    void OpenGLAPI::DeleteUBO(const TUBOID ubo)
+    {
+        glDeleteBuffers(1, &ubo);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        std::replace(m_bound_uniform_buffers.begin(), m_bound_uniform_buffers.end(), ubo, TUBOID{0});
+    }
+
     TShaderID OpenGLAPI::CreateShader(const GPUShaderType type, const std::string &code, const std::string &path)
     {
         int gl_shader_type = 0;
@@ -383,84 +658,127 @@ namespace MG3TR
         PRINT_GL_ERRORS_IF_ANY();
     }
 
+    std::vector<UniformDescription> OpenGLAPI::GetActiveUniforms(const TShaderProgramID shader_program)
+    {
+        GLint uniform_count = 0;
+        glGetProgramiv(shader_program, GL_ACTIVE_UNIFORMS, &uniform_count);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        GLint max_name_length = 0;
+        glGetProgramiv(shader_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        std::vector<UniformDescription> uniforms;
+        std::vector<GLchar> name_buffer(static_cast<std::size_t>(max_name_length) + 1U);
+
+        uniforms.reserve(static_cast<std::size_t>(uniform_count));
+
+        for (GLint uniform_index = 0; uniform_index < uniform_count; ++uniform_index)
+        {
+            GLsizei name_length = 0;
+            GLint array_size = 0;
+            GLenum gl_type = GL_NONE;
+
+            glGetActiveUniform(shader_program, static_cast<GLuint>(uniform_index), static_cast<GLsizei>(name_buffer.size()),
+                               &name_length, &array_size, &gl_type, &name_buffer[0]);
+            PRINT_GL_ERRORS_IF_ANY();
+
+            std::string name(&name_buffer[0], static_cast<std::size_t>(name_length));
+
+            // Arrays are reported as "name[0]", but are looked up by their plain name.
+            if (name.ends_with("[0]"))
+            {
+                name.resize(name.size() - 3U);
+            }
+
+            const GLint location = glGetUniformLocation(shader_program, name.c_str());
+            PRINT_GL_ERRORS_IF_ANY();
+
+            // Members of uniform blocks have no location and are not set individually.
+            if (location < 0)
+            {
+                continue;
+            }
+
+            const UniformDescription uniform{ std::move(name), static_cast<TUniformLocation>(location),
+                                              ConvertGLTypeToUniformType(gl_type) };
+            uniforms.push_back(uniform);
+        }
+
+        return uniforms;
+    }
+
     void OpenGLAPI::UseShader(const TShaderProgramID shader_program)
     {
+        if (ElideIfRedundant(shader_program == m_bound_program))
+        {
+            return;
+        }
+
         glUseProgram(shader_program);
         PRINT_GL_ERRORS_IF_ANY();
+
+        m_bound_program = shader_program;
     }
 
-    void OpenGLAPI::SetShaderUniformFloat(const TShaderProgramID shader_program,
-                                          const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformFloat(const UniformHandle<float> uniform,
                                           const float uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform1f(location, uniform_value);
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformInt(const TShaderProgramID shader_program,
-                                        const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformInt(const UniformHandle<int> uniform,
                                         const int uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform1i(location, uniform_value);
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformUnsigned(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformUnsigned(const UniformHandle<unsigned> uniform,
                                              const unsigned uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform1ui(location, uniform_value);
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformVector2(const TShaderProgramID shader_program,
-                                            const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformVector2(const UniformHandle<Vector2> uniform,
                                             const Vector2 uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform2fv(location, uniform_value.Size(), uniform_value.InternalDataPointer());
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformVector3(const TShaderProgramID shader_program,
-                                            const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformVector3(const UniformHandle<Vector3> uniform,
                                             const Vector3 uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform3f(location, uniform_value.x(), uniform_value.y(), uniform_value.z());
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformVector4(const TShaderProgramID shader_program,
-                                            const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformVector4(const UniformHandle<Vector4> uniform,
                                             const Vector4 uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniform4fv(location, uniform_value.Size(), uniform_value.InternalDataPointer());
         PRINT_GL_ERRORS_IF_ANY();
     }
 
-    void OpenGLAPI::SetShaderUniformMatrix4x4(const TShaderProgramID shader_program,
-                                              const std::string &uniform_name,
+    void OpenGLAPI::SetShaderUniformMatrix4x4(const UniformHandle<Matrix4x4> uniform,
                                               const Matrix4x4 uniform_value)
     {
-        const GLint location = glGetUniformLocation(shader_program, uniform_name.c_str());
-        PRINT_GL_ERRORS_IF_ANY();
+        const GLint location = static_cast<GLint>(uniform.GetLocation());
 
         glUniformMatrix4fv(location, 1, GL_FALSE, uniform_value.InternalDataPointer());
         PRINT_GL_ERRORS_IF_ANY();
@@ -469,12 +787,124 @@ namespace MG3TR
     void OpenGLAPI::DrawSubMesh(const SubMesh &submesh)
     {
         const TVAOID vao = submesh.GetVAO();
-        const std::size_t indices_size = submesh.GetIndices().size();
+        const std::size_t index_count = submesh.GetIndexCount();
+        const GLenum index_type = k_index_types[static_cast<std::size_t>(submesh.GetIndexType())];
+
+        BindVAO(vao);
+
+        glDrawElements(GL_TRIANGLES, index_count, index_type, nullptr);
+        PRINT_GL_ERRORS_IF_ANY();
+    }
+
+    void OpenGLAPI::DrawSubMeshInstanced(const SubMesh &submesh, const std::vector<Matrix4x4> &model_matrices)
+    {
+        if (model_matrices.empty())
+        {
+            return;
+        }
+
+        const TVAOID vao = submesh.GetVAO();
+        const std::size_t index_count = submesh.GetIndexCount();
+        const GLenum index_type = k_index_types[static_cast<std::size_t>(submesh.GetIndexType())];
+        const std::size_t instance_count = model_matrices.size();
+
+        UploadInstanceData(model_matrices);
+
+        BindVAO(vao);
+        AttachInstanceBuffer(vao);
+
+        glDrawElementsInstanced(GL_TRIANGLES, index_count, index_type, nullptr, instance_count);
+        PRINT_GL_ERRORS_IF_ANY();
+    }
+
+    StateChangeStatistics OpenGLAPI::GetStateChangeStatistics() const
+    {
+        return m_statistics;
+    }
+
+    void OpenGLAPI::ResetStateChangeStatistics()
+    {
+        m_statistics = {};
+    }
+
+    void OpenGLAPI::BindVAO(const TVAOID vao)
+    {
+        if (ElideIfRedundant(vao == m_bound_vao))
+        {
+            return;
+        }
 
         glBindVertexArray(vao);
         PRINT_GL_ERRORS_IF_ANY();
 
-        glDrawElements(GL_TRIANGLES, indices_size, GL_UNSIGNED_INT, nullptr);
+        m_bound_vao = vao;
+    }
+
+    bool OpenGLAPI::ElideIfRedundant(const bool is_redundant)
+    {
+        if (is_redundant)
+        {
+            ++m_statistics.m_elided_calls;
+        }
+        else
+        {
+            ++m_statistics.m_issued_calls;
+        }
+
+        return is_redundant;
+    }
+
+    void OpenGLAPI::UploadInstanceData(const std::vector<Matrix4x4> &model_matrices)
+    {
+        // The matrices are trivially copyable and tightly packed, so they are uploaded in place.
+        static_assert(sizeof(Matrix4x4) == 16 * sizeof(float));
+
+        if (m_instance_buffer == 0)
+        {
+            glGenBuffers(1, &m_instance_buffer);
+            PRINT_GL_ERRORS_IF_ANY();
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, m_instance_buffer);
         PRINT_GL_ERRORS_IF_ANY();
+
+        // Reallocating the storage every time lets the driver hand out fresh memory instead of
+        // waiting for the previous draw to finish reading the buffer.
+        const std::size_t memory_size = model_matrices.size() * sizeof(Matrix4x4);
+        m_instance_buffer_size = std::max(m_instance_buffer_size, memory_size);
+
+        glBufferData(GL_ARRAY_BUFFER, m_instance_buffer_size, nullptr, GL_STREAM_DRAW);
+        PRINT_GL_ERRORS_IF_ANY();
+
+        glBufferSubData(GL_ARRAY_BUFFER, 0, memory_size, model_matrices.data());
+        PRINT_GL_ERRORS_IF_ANY();
+    }
+
+    // Expects the VAO and the instance buffer to be bound.
+    void OpenGLAPI::AttachInstanceBuffer(const TVAOID vao)
+    {
+        const bool is_attached = !m_instanced_vaos.insert(vao).second;
+        if (is_attached)
+        {
+            return;
+        }
+
+        const GLsizei stride = static_cast<GLsizei>(16 * sizeof(float));
+
+        // A mat4 attribute takes one location per column.
+        for (unsigned column = 0U; column < 4U; ++column)
+        {
+            const unsigned location = MeshConstants::k_instance_model_location + column;
+            const std::size_t offset = column * 4 * sizeof(float);
+
+            glEnableVertexAttribArray(location);
+            PRINT_GL_ERRORS_IF_ANY();
+
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offset));
+            PRINT_GL_ERRORS_IF_ANY();
+
+            glVertexAttribDivisor(location, 1);
+            PRINT_GL_ERRORS_IF_ANY();
+        }
     }
-}
\ No newline at end of file
+}
@@ -1,14 +1,42 @@
 #ifndef MG3TR_SRC_GRAPHICS_API_OPENGLAPI_HPP_INCLUDED
 #define MG3TR_SRC_GRAPHICS_API_OPENGLAPI_HPP_INCLUDED
 
+#include "GLValidationLevel.hpp"
 #include "IGraphicsAPI.hpp"
 
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
 namespace MG3TR
 {
+    // Shadows the state it sets, so requests for the state that is already
+    // current do not reach the driver. Objects are expected to be bound only
+    // through this class.
     class OpenGLAPI : public IGraphicsAPI
     {
+    private:
+        static constexpr std::size_t k_cached_texture_units = 16;
+        static constexpr std::size_t k_cached_uniform_buffer_bindings = 16;
+
+        TShaderProgramID m_bound_program;
+        TVAOID m_bound_vao;
+        TTextureUnitID m_active_texture_unit;
+        std::array<TTextureID, k_cached_texture_units> m_bound_textures;
+        std::array<TUBOID, k_cached_uniform_buffer_bindings> m_bound_uniform_buffers;
+        bool m_is_depth_test_enabled;
+        bool m_is_back_face_culling_enabled;
+
+        StateChangeStatistics m_statistics;
+
+        // Streamed each instanced draw; VAOs that already point their instance attributes at it are remembered.
+        TVBOID m_instance_buffer;
+        std::size_t m_instance_buffer_size;
+        std::unordered_set<TVAOID> m_instanced_vaos;
+
     public:
-        OpenGLAPI() = default;
+        OpenGLAPI();
         virtual ~OpenGLAPI() = default;
 
         OpenGLAPI(const OpenGLAPI &) = delete;
@@ -20,6 +48,10 @@ namespace MG3TR
         virtual void Initialise(void *const load_process) override;
         virtual void Finalise() override;
 
+        // The level is capped by MG3TR_GL_VALIDATION_LEVEL. Changing it requires a current context.
+        void SetValidationLevel(const GLValidationLevel level);
+        GLValidationLevel GetValidationLevel() const;
+
         virtual void SetDepthTest(const bool enable) override;
         virtual void SetBackFaceCulling(const bool enable) override;
         virtual void ClearScreen() override;
@@ -34,8 +66,7 @@ namespace MG3TR
         virtual TVAOID CreateVAO() override;
         virtual TVBOID CreateVBO(const void *const data,
                                  const std::size_t memory_size,
-                                 const std::size_t vertex_size,
-                                 const unsigned location) override;
+                                 const VertexLayout &layout) override;
         virtual TIBOID CreateIBO(const void *const data,
                                  const std::size_t memory_size) override;
         
@@ -43,6 +74,11 @@ namespace MG3TR
         virtual void DeleteVBO(const TVBOID vbo) override;
         virtual void DeleteIBO(const TIBOID ibo) override;
 
+        virtual TUBOID CreateUBO(const std::size_t memory_size) override;
+        virtual void UpdateUBO(const TUBOID ubo, const void *const data, const std::size_t memory_size) override;
+        virtual void BindUBO(const TUBOID ubo, const unsigned binding_point) override;
+        virtual void DeleteUBO(const TUBOID ubo) override;
+
         virtual TShaderID CreateShader(const GPUShaderType type, const std::string &code, const std::string &path) override;
         virtual TShaderProgramID CreateShaderProgram(const TShaderID vertex_shader,
                                                      const TShaderID fragment_shader) override;
@@ -51,30 +87,34 @@ namespace MG3TR
                                                      const TShaderID fragment_shader) override;
         virtual void DeleteShader(const TShaderProgramID shader_program, const TShaderID shader) override;
         virtual void DeleteShaderProgram(const TShaderProgramID shader_program) override;
+        virtual std::vector<UniformDescription> GetActiveUniforms(const TShaderProgramID shader_program) override;
         virtual void UseShader(const TShaderProgramID shader_program) override;
-        virtual void SetShaderUniformFloat(const TShaderProgramID shader_program,
-                                           const std::string &uniform_name,
+        virtual void SetShaderUniformFloat(const UniformHandle<float> uniform,
                                            const float uniform_value) override;
-        virtual void SetShaderUniformInt(const TShaderProgramID shader_program,
-                                         const std::string &uniform_name,
+        virtual void SetShaderUniformInt(const UniformHandle<int> uniform,
                                          const int uniform_value) override;
-        virtual void SetShaderUniformUnsigned(const TShaderProgramID shader_program,
-                                              const std::string &uniform_name,
+        virtual void SetShaderUniformUnsigned(const UniformHandle<unsigned> uniform,
                                               const unsigned uniform_value) override;
-        virtual void SetShaderUniformVector2(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector2(const UniformHandle<Vector2> uniform,
                                              const Vector2 uniform_value) override;
-        virtual void SetShaderUniformVector3(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector3(const UniformHandle<Vector3> uniform,
                                              const Vector3 uniform_value) override;
-        virtual void SetShaderUniformVector4(const TShaderProgramID shader_program,
-                                             const std::string &uniform_name,
+        virtual void SetShaderUniformVector4(const UniformHandle<Vector4> uniform,
                                              const Vector4 uniform_value) override;
-        virtual void SetShaderUniformMatrix4x4(const TShaderProgramID shader_program,
-                                               const std::string &uniform_name,
+        virtual void SetShaderUniformMatrix4x4(const UniformHandle<Matrix4x4> uniform,
                                                const Matrix4x4 uniform_value) override;
 
         virtual void DrawSubMesh(const SubMesh &submesh) override;
+        virtual void DrawSubMeshInstanced(const SubMesh &submesh, const std::vector<Matrix4x4> &model_matrices) override;
+
+        virtual StateChangeStatistics GetStateChangeStatistics() const override;
+        virtual void ResetStateChangeStatistics() override;
+
+    private:
+        void BindVAO(const TVAOID vao);
+        bool ElideIfRedundant(const bool is_redundant);
+        void UploadInstanceData(const std::vector<Matrix4x4> &model_matrices);
+        void AttachInstanceBuffer(const TVAOID vao);
     };
 }
 
@@ -0,0 +1,82 @@
+#ifndef MG3TR_SRC_GRAPHICS_API_UNIFORMHANDLE_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_API_UNIFORMHANDLE_HPP_INCLUDED
+
+#include "GraphicsTypes.hpp"
+
+#include <Math/Matrix4x4.hpp>
+#include <Math/Vector2.hpp>
+#include <Math/Vector3.hpp>
+#include <Math/Vector4.hpp>
+
+#include <string>
+#include <type_traits>
+
+namespace MG3TR
+{
+    enum class GPUUniformType : unsigned char
+    {
+        Float,
+        Int,
+        Unsigned,
+        Vector2,
+        Vector3,
+        Vector4,
+        Matrix4x4,
+        Sampler,
+        Unsupported
+    };
+
+    // Uniform reported by the graphics API after a program has been linked.
+    struct UniformDescription
+    {
+        std::string m_name;
+        TUniformLocation m_location;
+        GPUUniformType m_type;
+    };
+
+    template <typename TValue>
+    constexpr GPUUniformType GetUniformTypeOf()
+    {
+        if constexpr (std::is_same_v<TValue, float>)          { return GPUUniformType::Float; }
+        else if constexpr (std::is_same_v<TValue, int>)       { return GPUUniformType::Int; }
+        else if constexpr (std::is_same_v<TValue, unsigned>)  { return GPUUniformType::Unsigned; }
+        else if constexpr (std::is_same_v<TValue, Vector2>)   { return GPUUniformType::Vector2; }
+        else if constexpr (std::is_same_v<TValue, Vector3>)   { return GPUUniformType::Vector3; }
+        else if constexpr (std::is_same_v<TValue, Vector4>)   { return GPUUniformType::Vector4; }
+        else if constexpr (std::is_same_v<TValue, Matrix4x4>) { return GPUUniformType::Matrix4x4; }
+        else                                                  { return GPUUniformType::Unsupported; }
+    }
+
+    // Location of a uniform resolved once after linking. The value type is part
+    // of the handle, so it can only be passed to the matching setter.
+    template <typename TValue>
+    class UniformHandle
+    {
+    private:
+        TUniformLocation m_location;
+
+    public:
+        constexpr UniformHandle(const TUniformLocation location = k_invalid_uniform_location)
+            : m_location(location)
+        {}
+        constexpr ~UniformHandle() = default;
+
+        constexpr UniformHandle(const UniformHandle &) = default;
+        constexpr UniformHandle(UniformHandle &&) = default;
+
+        constexpr UniformHandle& operator=(const UniformHandle &) = default;
+        constexpr UniformHandle& operator=(UniformHandle &&) = default;
+
+        constexpr TUniformLocation GetLocation() const
+        {
+            return m_location;
+        }
+
+        constexpr bool IsValid() const
+        {
+            return m_location != k_invalid_uniform_location;
+        }
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_API_UNIFORMHANDLE_HPP_INCLUDED
@@ -0,0 +1,56 @@
+#include "VertexLayout.hpp"
+
+#include <cstdint>
+
+namespace MG3TR
+{
+    VertexLayout::VertexLayout()
+        : m_attributes(),
+          m_stride(0)
+    {
+
+    }
+
+    void VertexLayout::AddAttribute(const unsigned location, const GPUAttributeFormat format)
+    {
+        m_attributes.push_back(VertexAttribute{ location, format, m_stride });
+        m_stride += GetFormatSize(format);
+    }
+
+    const std::vector<VertexAttribute>& VertexLayout::GetAttributes() const
+    {
+        return m_attributes;
+    }
+
+    std::size_t VertexLayout::GetStride() const
+    {
+        return m_stride;
+    }
+
+    std::size_t VertexLayout::GetFormatSize(const GPUAttributeFormat format)
+    {
+        std::size_t size = 0;
+
+        switch (format)
+        {
+            case GPUAttributeFormat::Float2:
+            {
+                size = 2 * sizeof(float);
+                break;
+            }
+            case GPUAttributeFormat::Float3:
+            {
+                size = 3 * sizeof(float);
+                break;
+            }
+            case GPUAttributeFormat::Half2:
+            case GPUAttributeFormat::Snorm16x2:
+            {
+                size = 2 * sizeof(std::uint16_t);
+                break;
+            }
+        }
+
+        return size;
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef MG3TR_SRC_GRAPHICS_API_VERTEXLAYOUT_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_API_VERTEXLAYOUT_HPP_INCLUDED
+
+#include <cstddef>
+#include <vector>
+
+namespace MG3TR
+{
+    enum class GPUAttributeFormat : unsigned char
+    {
+        Float2,
+        Float3,
+        // Two half precision floats, read by the shader as a vec2.
+        Half2,
+        // Two normalised 16-bit signed integers, read by the shader as a vec2 in [-1, 1].
+        Snorm16x2
+    };
+
+    struct VertexAttribute
+    {
+        unsigned m_location;
+        GPUAttributeFormat m_format;
+        std::size_t m_offset;
+    };
+
+    // Describes how the attributes of a vertex are interleaved in a single buffer.
+    // Attributes are laid out in the order they are added, without padding.
+    class VertexLayout
+    {
+    private:
+        std::vector<VertexAttribute> m_attributes;
+        std::size_t m_stride;
+
+    public:
+        VertexLayout();
+        virtual ~VertexLayout() = default;
+
+        VertexLayout(const VertexLayout &) = default;
+        VertexLayout(VertexLayout &&) = default;
+
+        VertexLayout& operator=(const VertexLayout &) = default;
+        VertexLayout& operator=(VertexLayout &&) = default;
+
+        void AddAttribute(const unsigned location, const GPUAttributeFormat format);
+
+        const std::vector<VertexAttribute>& GetAttributes() const;
+        std::size_t GetStride() const;
+
+        static std::size_t GetFormatSize(const GPUAttributeFormat format);
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_API_VERTEXLAYOUT_HPP_INCLUDED
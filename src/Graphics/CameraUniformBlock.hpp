@@ -0,0 +1,19 @@
+#ifndef MG3TR_SRC_GRAPHICS_CAMERAUNIFORMBLOCK_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_CAMERAUNIFORMBLOCK_HPP_INCLUDED
+
+namespace MG3TR
+{
+    // Mirrors the std140 "CameraBlock" declared in res/Shaders. Every member is
+    // a multiple of 16 bytes, so the C++ layout matches std140 without padding.
+    struct CameraUniformBlock
+    {
+        float m_view[16];
+        float m_projection[16];
+        float m_view_projection[16];
+        float m_camera_position[4];
+    };
+
+    static_assert(sizeof(CameraUniformBlock) == 208, "CameraUniformBlock does not match the std140 layout.");
+}
+
+#endif // MG3TR_SRC_GRAPHICS_CAMERAUNIFORMBLOCK_HPP_INCLUDED
@@ -0,0 +1,43 @@
+#ifndef MG3TR_SRC_GRAPHICS_DRAWMATERIAL_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_DRAWMATERIAL_HPP_INCLUDED
+
+#include <Graphics/API/GraphicsTypes.hpp>
+#include <Graphics/API/UniformHandle.hpp>
+#include <Math/Matrix4x4.hpp>
+#include <Math/Vector3.hpp>
+
+#include <memory>
+
+namespace MG3TR
+{
+    class ShaderProgram;
+    class Texture;
+    class UniformBuffer;
+
+    // Everything needed to draw with a shader, resolved on the thread that runs the scene. The thread
+    // that renders only issues graphics calls from it and never reads the shader.
+    //
+    // The shared pointers keep the GPU objects alive while frames that draw with them are pending,
+    // even if the scene releases them in the meantime.
+    struct DrawMaterial
+    {
+        std::shared_ptr<const ShaderProgram> m_program;
+        // Null if the shader does not support instancing.
+        std::shared_ptr<const ShaderProgram> m_instanced_program;
+        std::shared_ptr<const Texture> m_texture;
+        // Null if the shader does not read the camera block. Its buffer only exists after the first
+        // upload on the thread that renders, so the buffer is referenced instead of its ID.
+        std::shared_ptr<const UniformBuffer> m_camera_buffer;
+
+        TShaderProgramID m_program_id;
+        TShaderProgramID m_instanced_program_id;
+        TTextureID m_texture_id;
+
+        // Uniforms the shader does not have are left invalid.
+        UniformHandle<Matrix4x4> m_model_uniform;
+        UniformHandle<Vector3> m_light_position_uniform;
+        Vector3 m_light_position;
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_DRAWMATERIAL_HPP_INCLUDED
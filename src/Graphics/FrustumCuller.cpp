@@ -0,0 +1,142 @@
+#include "FrustumCuller.hpp"
+
+#include <Components/Camera.hpp>
+#include <Components/MeshRenderer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+// Compares the control blocks, which the weak pointer keeps alive, so that a camera created at the
+// address of a destroyed one is not mistaken for it.
+static bool IsSameCamera(const std::weak_ptr<MG3TR::Camera> &lhs, const std::shared_ptr<MG3TR::Camera> &rhs)
+{
+    const bool is_same = !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+    return is_same;
+}
+
+
+
+namespace MG3TR
+{
+    FrustumCuller FrustumCuller::m_instance;
+
+    FrustumCuller::FrustumCuller()
+        : m_hierarchy(),
+          m_renderers(),
+          m_submesh_indices(),
+          m_cameras(),
+          m_is_submitted(),
+          m_submitted_proxies(),
+          m_frame_cameras(),
+          m_visible_proxies(),
+          m_frame_statistics{}
+    {
+
+    }
+
+    FrustumCuller& FrustumCuller::GetInstance()
+    {
+        return m_instance;
+    }
+
+    TBVHProxy FrustumCuller::Add(MeshRenderer &renderer, const std::size_t submesh_index,
+                                 const std::weak_ptr<Camera> &camera, const Sphere &world_space_sphere)
+    {
+        const TBVHProxy proxy = m_hierarchy.Insert(world_space_sphere);
+
+        if (proxy >= m_renderers.size())
+        {
+            m_renderers.resize(proxy + 1U, nullptr);
+            m_submesh_indices.resize(proxy + 1U, 0U);
+            m_cameras.resize(proxy + 1U);
+            m_is_submitted.resize(proxy + 1U, 0U);
+        }
+
+        m_renderers[proxy] = &renderer;
+        m_submesh_indices[proxy] = submesh_index;
+        m_cameras[proxy] = camera;
+
+        return proxy;
+    }
+
+    void FrustumCuller::Remove(const TBVHProxy proxy)
+    {
+        m_hierarchy.Remove(proxy);
+
+        m_renderers[proxy] = nullptr;
+        m_cameras[proxy].reset();
+        m_is_submitted[proxy] = 0U;
+    }
+
+    void FrustumCuller::Move(const TBVHProxy proxy, const Sphere &world_space_sphere)
+    {
+        m_hierarchy.Move(proxy, world_space_sphere);
+    }
+
+    void FrustumCuller::Submit(const TBVHProxy proxy)
+    {
+        if (m_is_submitted[proxy] != 0U)
+        {
+            return;
+        }
+
+        std::shared_ptr<Camera> camera = m_cameras[proxy].lock();
+        if (camera == nullptr)
+        {
+            return;
+        }
+
+        m_is_submitted[proxy] = 1U;
+        m_submitted_proxies.push_back(proxy);
+
+        if (std::find(m_frame_cameras.cbegin(), m_frame_cameras.cend(), camera) == m_frame_cameras.cend())
+        {
+            m_frame_cameras.push_back(std::move(camera));
+        }
+    }
+
+    void FrustumCuller::Execute()
+    {
+        m_hierarchy.Update();
+        m_frame_statistics = {};
+
+        for (const std::shared_ptr<Camera> &camera : m_frame_cameras)
+        {
+            m_visible_proxies.clear();
+            m_hierarchy.CullFrustum(camera->GetFrustum(), m_visible_proxies);
+
+            const BVHCullStatistics &statistics = m_hierarchy.GetLastCullStatistics();
+            m_frame_statistics.m_nodes_visited += statistics.m_nodes_visited;
+            m_frame_statistics.m_objects_tested += statistics.m_objects_tested;
+
+            // The hierarchy holds the submeshes of every camera, and those that were not submitted.
+            for (const TBVHProxy proxy : m_visible_proxies)
+            {
+                if ((m_is_submitted[proxy] != 0U) && IsSameCamera(m_cameras[proxy], camera))
+                {
+                    m_renderers[proxy]->SubmitDraw(m_submesh_indices[proxy]);
+                    ++m_frame_statistics.m_objects_visible;
+                }
+            }
+        }
+
+        for (const TBVHProxy proxy : m_submitted_proxies)
+        {
+            m_is_submitted[proxy] = 0U;
+        }
+
+        m_submitted_proxies.clear();
+        m_frame_cameras.clear();
+    }
+
+    const BVHCullStatistics& FrustumCuller::GetFrameStatistics() const
+    {
+        return m_frame_statistics;
+    }
+
+    BoundingVolumeHierarchy& FrustumCuller::GetHierarchy()
+    {
+        return m_hierarchy;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef MG3TR_SRC_GRAPHICS_FRUSTUMCULLER_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_FRUSTUMCULLER_HPP_INCLUDED
+
+#include <Math/BoundingVolumeHierarchy.hpp>
+#include <Math/Sphere.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MG3TR
+{
+    class Camera;
+    class MeshRenderer;
+
+    // Keeps the world space bounding spheres of the rendered submeshes in a bounding volume hierarchy,
+    // which is queried with the frustum of every camera that has something to draw. The submeshes that
+    // were submitted for the frame and are visible are then drawn through their renderer.
+    //
+    // Renderers add their spheres once and move them when their transform changes. The renderers are
+    // not owned and must remove their proxies before they are destroyed. Cameras are only referenced
+    // weakly, so the proxies of a destroyed camera are no longer drawn.
+    class FrustumCuller
+    {
+    private:
+        BoundingVolumeHierarchy m_hierarchy;
+
+        // Indexed by proxy.
+        std::vector<MeshRenderer*> m_renderers;
+        std::vector<std::size_t> m_submesh_indices;
+        std::vector<std::weak_ptr<Camera>> m_cameras;
+        std::vector<std::uint8_t> m_is_submitted;
+
+        std::vector<TBVHProxy> m_submitted_proxies;
+        // Cameras of the submitted proxies, kept alive until the end of Execute.
+        std::vector<std::shared_ptr<Camera>> m_frame_cameras;
+        std::vector<TBVHProxy> m_visible_proxies;
+
+        BVHCullStatistics m_frame_statistics;
+
+        static FrustumCuller m_instance;
+
+        FrustumCuller();
+        ~FrustumCuller() = default;
+
+    public:
+        FrustumCuller(const FrustumCuller &) = delete;
+        FrustumCuller(FrustumCuller &&) = delete;
+
+        FrustumCuller& operator=(const FrustumCuller &) = delete;
+        FrustumCuller& operator=(FrustumCuller &&) = delete;
+
+        static FrustumCuller& GetInstance();
+
+        TBVHProxy Add(MeshRenderer &renderer, const std::size_t submesh_index, const std::weak_ptr<Camera> &camera,
+                      const Sphere &world_space_sphere);
+        void Remove(const TBVHProxy proxy);
+        void Move(const TBVHProxy proxy, const Sphere &world_space_sphere);
+
+        // Only the proxies submitted since the last Execute are drawn. Proxies whose camera was destroyed
+        // are ignored.
+        void Submit(const TBVHProxy proxy);
+        void Execute();
+
+        // Summed over the cameras of the last Execute.
+        const BVHCullStatistics& GetFrameStatistics() const;
+
+        BoundingVolumeHierarchy& GetHierarchy();
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_FRUSTUMCULLER_HPP_INCLUDED
@@ -2,11 +2,16 @@
 #define M3GTR_SRC_GRAPHICS_MESH_HPP_INCLUDED
 
 #include <Graphics/Material.hpp>
+#include <Graphics/MeshData.hpp>
 #include <Graphics/SubMesh.hpp>
+#include <Math/BoundingBox.hpp>
+#include <Math/Sphere.hpp>
 #include <Math/Vector2.hpp>
 #include <Math/Vector3.hpp>
 #include <Serialisation/ISerialisable.hpp>
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,8 +20,7 @@ namespace MG3TR
     class Mesh : public ISerialisable
     {
     private:
-        std::vector<SubMesh> m_submeshes;
-        std::vector<Material> m_materials;
+        std::shared_ptr<const MeshData> m_data;
 
         std::string m_path_to_file;
 
@@ -30,15 +34,21 @@ namespace MG3TR
 
         virtual ~Mesh() = default;
 
-        Mesh(const Mesh &);
+        Mesh(const Mesh &) = default;
         Mesh(Mesh &&) = default;
         
-        Mesh& operator=(const Mesh &);
-        Mesh& operator=(Mesh &&);
+        Mesh& operator=(const Mesh &) = default;
+        Mesh& operator=(Mesh &&) = default;
 
         const std::vector<SubMesh>& GetSubmeshes() const;
+        // Shares ownership of the mesh data, so the submesh stays valid even if the mesh goes away.
+        std::shared_ptr<const SubMesh> GetSharedSubmesh(const std::size_t index) const;
         const std::vector<Material>& GetMaterials() const;
 
+        // In the space of the vertices.
+        BoundingBox GetBoundingBox() const;
+        Sphere GetBoundingSphere() const;
+
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
 
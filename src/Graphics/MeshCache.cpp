@@ -0,0 +1,69 @@
+#include "MeshCache.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <system_error>
+
+// Same as the texture cache, so that different spellings of a path share one import.
+static std::string CanonicalisePath(const std::string &path_to_file)
+{
+    const std::filesystem::path path(path_to_file);
+
+    std::error_code error_code;
+    const std::filesystem::path canonical_path = std::filesystem::weakly_canonical(path, error_code);
+
+    const std::string result = error_code ? path.lexically_normal().generic_string() : canonical_path.generic_string();
+    return result;
+}
+
+namespace MG3TR
+{
+    std::size_t MeshDataKeyHash::operator()(const MeshDataKey &key) const
+    {
+        std::size_t seed = std::hash<std::string>{}(key.m_path_to_file);
+        const std::size_t flags_hash = std::hash<unsigned>{}(key.m_import_flags);
+
+        seed ^= flags_hash + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2);
+
+        return seed;
+    }
+
+    MeshCache MeshCache::m_instance;
+
+    MeshCache& MeshCache::GetInstance()
+    {
+        return m_instance;
+    }
+
+    std::shared_ptr<const MeshData> MeshCache::GetMeshData(const std::string &path_to_file, const unsigned import_flags)
+    {
+        MeshDataKey key{ CanonicalisePath(path_to_file), import_flags };
+
+        const auto mesh_iterator = m_meshes.find(key);
+        if (mesh_iterator != m_meshes.end())
+        {
+            auto mesh_data = mesh_iterator->second.lock();
+            if (mesh_data != nullptr)
+            {
+                return mesh_data;
+            }
+        }
+
+        // Drop the entries of meshes that are no longer used by anyone.
+        (void)std::erase_if(m_meshes, [](const auto &entry) { return entry.second.expired(); });
+
+        std::shared_ptr<const MeshData> mesh_data = std::make_shared<MeshData>(path_to_file, import_flags);
+        m_meshes[std::move(key)] = mesh_data;
+
+        return mesh_data;
+    }
+
+    std::size_t MeshCache::GetLiveMeshCount() const
+    {
+        const auto live_count = std::count_if(m_meshes.cbegin(), m_meshes.cend(),
+                                              [](const auto &entry) { return !entry.second.expired(); });
+
+        return static_cast<std::size_t>(live_count);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef MG3TR_SRC_GRAPHICS_MESHCACHE_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_MESHCACHE_HPP_INCLUDED
+
+#include <Graphics/MeshData.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace MG3TR
+{
+    struct MeshDataKey
+    {
+        std::string m_path_to_file;
+        unsigned m_import_flags;
+
+        bool operator==(const MeshDataKey &other) const = default;
+    };
+
+    struct MeshDataKeyHash
+    {
+        std::size_t operator()(const MeshDataKey &key) const;
+    };
+
+    // Process wide registry of imported meshes. The cache only keeps weak
+    // references, so the data lives as long as at least one mesh uses it.
+    class MeshCache
+    {
+    private:
+        std::unordered_map<MeshDataKey, std::weak_ptr<const MeshData>, MeshDataKeyHash> m_meshes;
+
+        static MeshCache m_instance;
+
+        MeshCache() = default;
+        ~MeshCache() = default;
+
+    public:
+        MeshCache(const MeshCache &) = delete;
+        MeshCache(MeshCache &&) = delete;
+
+        MeshCache& operator=(const MeshCache &) = delete;
+        MeshCache& operator=(MeshCache &&) = delete;
+
+        static MeshCache& GetInstance();
+
+        std::shared_ptr<const MeshData> GetMeshData(const std::string &path_to_file, const unsigned import_flags);
+
+        std::size_t GetLiveMeshCount() const;
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_MESHCACHE_HPP_INCLUDED
@@ -0,0 +1,56 @@
+#ifndef MG3TR_SRC_GRAPHICS_MESHDATA_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_MESHDATA_HPP_INCLUDED
+
+#include <Graphics/Material.hpp>
+#include <Graphics/SubMesh.hpp>
+#include <Math/BoundingBox.hpp>
+#include <Math/Sphere.hpp>
+#include <Math/Vector2.hpp>
+#include <Math/Vector3.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MG3TR
+{
+    // Immutable geometry and GPU buffers of a mesh. Instances read from files
+    // are shared between meshes through MeshCache and released with the last owner.
+    class MeshData
+    {
+    private:
+        std::vector<SubMesh> m_submeshes;
+        std::vector<Material> m_materials;
+
+        // Enclose every submesh. Computed on import, so meshes sharing the data share them too.
+        BoundingBox m_bounding_box;
+        Sphere m_bounding_sphere;
+
+    public:
+        MeshData(const std::vector<Vector3> &vertices,
+                 const std::vector<Vector3> &normals,
+                 const std::vector<Vector2> &uvs,
+                 const std::vector<std::uint32_t> &indices);
+
+        MeshData(const std::string &path_to_file, const unsigned import_flags);
+
+        virtual ~MeshData() = default;
+
+        MeshData(const MeshData &) = delete;
+        MeshData(MeshData &&) = delete;
+
+        MeshData& operator=(const MeshData &) = delete;
+        MeshData& operator=(MeshData &&) = delete;
+
+        const std::vector<SubMesh>& GetSubmeshes() const;
+        const std::vector<Material>& GetMaterials() const;
+
+        BoundingBox GetBoundingBox() const;
+        Sphere GetBoundingSphere() const;
+
+    private:
+        void ComputeBounds();
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_MESHDATA_HPP_INCLUDED
@@ -0,0 +1,14 @@
+#ifndef MG3TR_SRC_GRAPHICS_RENDERPASS_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_RENDERPASS_HPP_INCLUDED
+
+namespace MG3TR
+{
+    // Passes are executed in ascending order.
+    enum class RenderPass : unsigned char
+    {
+        Opaque = 0,
+        AlphaTested = 1
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_RENDERPASS_HPP_INCLUDED
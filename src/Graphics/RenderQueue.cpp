@@ -0,0 +1,408 @@
+#include "RenderQueue.hpp"
+
+#include <Constants/GraphicsConstants.hpp>
+#include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/SubMesh.hpp>
+#include <Graphics/UniformBuffer.hpp>
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+static const unsigned k_pass_bits = 4U;
+static const unsigned k_program_bits = 10U;
+static const unsigned k_texture_bits = 14U;
+static const unsigned k_vao_bits = 12U;
+static const unsigned k_depth_bits = 24U;
+
+// Below this many packets, the cost of streaming the instance data outweighs the saved draw calls.
+static const std::size_t k_min_instanced_batch_size = 2U;
+
+static_assert(k_pass_bits + k_program_bits + k_texture_bits + k_vao_bits + k_depth_bits == 64U);
+
+static const unsigned k_depth_shift = 0U;
+static const unsigned k_vao_shift = k_depth_shift + k_depth_bits;
+static const unsigned k_texture_shift = k_vao_shift + k_vao_bits;
+static const unsigned k_program_shift = k_texture_shift + k_texture_bits;
+static const unsigned k_pass_shift = k_program_shift + k_program_bits;
+
+static std::uint64_t PackField(const std::uint64_t value, const unsigned bits, const unsigned shift)
+{
+    const std::uint64_t mask = (std::uint64_t{1} << bits) - 1U;
+    const std::uint64_t field = (value & mask) << shift;
+
+    return field;
+}
+
+// LSD radix sort on the keys, one byte per pass. Passes in which every key has
+// the same byte are skipped, which is common for the high bytes of small scenes.
+static void RadixSortPackets(std::vector<MG3TR::DrawPacket> &packets, std::vector<MG3TR::DrawPacket> &buffer)
+{
+    const std::size_t packet_count = packets.size();
+    buffer.resize(packet_count);
+
+    for (unsigned shift = 0U; shift < 64U; shift += 8U)
+    {
+        std::array<std::size_t, 256> offsets{};
+
+        for (const auto &packet : packets)
+        {
+            ++offsets[(packet.m_sort_key >> shift) & 0xFFU];
+        }
+
+        const bool is_byte_constant = std::any_of(offsets.cbegin(), offsets.cend(),
+                                                  [packet_count](const std::size_t count) { return count == packet_count; });
+        if (is_byte_constant)
+        {
+            continue;
+        }
+
+        std::size_t total = 0;
+        for (auto &offset : offsets)
+        {
+            const std::size_t count = offset;
+            offset = total;
+            total += count;
+        }
+
+        for (auto &packet : packets)
+        {
+            buffer[offsets[(packet.m_sort_key >> shift) & 0xFFU]++] = std::move(packet);
+        }
+
+        packets.swap(buffer);
+    }
+}
+
+// Whether draws with either material can share the material uniforms and bindings.
+static bool HasSameMaterial(const MG3TR::DrawMaterial &material, const MG3TR::DrawMaterial &other)
+{
+    if (&material == &other)
+    {
+        return true;
+    }
+
+    const bool is_same_material = (material.m_program_id == other.m_program_id)
+                                  && (material.m_texture_id == other.m_texture_id)
+                                  && (material.m_camera_buffer == other.m_camera_buffer)
+                                  && (material.m_light_position_uniform.GetLocation() == other.m_light_position_uniform.GetLocation())
+                                  && (material.m_light_position == other.m_light_position);
+    return is_same_material;
+}
+
+namespace MG3TR
+{
+    RenderQueue RenderQueue::m_instance;
+
+    RenderQueue::RenderQueue()
+        : m_frames(),
+          m_published_frame_count(0),
+          m_executed_frame_count(0),
+          m_render_signal(0),
+          m_is_wait_interrupted(false),
+          m_rendering_thread(),
+          m_release_mutex(),
+          m_pending_releases(),
+          m_sort_buffer(),
+          m_instance_matrices(),
+          m_bound_material(nullptr),
+          m_bound_program(0),
+          m_bound_texture(0)
+    {
+
+    }
+
+    RenderQueue& RenderQueue::GetInstance()
+    {
+        return m_instance;
+    }
+
+    std::uint64_t RenderQueue::CreateSortKey(const RenderPass pass, const TShaderProgramID program,
+                                             const TTextureID texture, const TVAOID vao, const float normalised_depth)
+    {
+        const std::uint64_t max_depth = (std::uint64_t{1} << k_depth_bits) - 1U;
+        const float clamped_depth = std::clamp(normalised_depth, 0.0F, 1.0F);
+        const auto quantised_depth = static_cast<std::uint64_t>(clamped_depth * static_cast<float>(max_depth));
+
+        const std::uint64_t key = PackField(static_cast<std::uint64_t>(pass), k_pass_bits, k_pass_shift)
+                                  | PackField(program, k_program_bits, k_program_shift)
+                                  | PackField(texture, k_texture_bits, k_texture_shift)
+                                  | PackField(vao, k_vao_bits, k_vao_shift)
+                                  | PackField(quantised_depth, k_depth_bits, k_depth_shift);
+        return key;
+    }
+
+    // The packet of the next frame is free once the frame that used it before has been executed.
+    void RenderQueue::BeginFrame()
+    {
+        const std::uint64_t frame = m_published_frame_count.load(std::memory_order_relaxed);
+        std::uint64_t executed_frame_count = m_executed_frame_count.load(std::memory_order_acquire);
+
+        while ((frame - executed_frame_count) >= k_frame_packet_count)
+        {
+            m_executed_frame_count.wait(executed_frame_count, std::memory_order_acquire);
+            executed_frame_count = m_executed_frame_count.load(std::memory_order_acquire);
+        }
+    }
+
+    void RenderQueue::Submit(DrawPacket &&packet)
+    {
+        GetRecordedFrame().m_draws.push_back(std::move(packet));
+    }
+
+    void RenderQueue::SubmitCamera(const std::shared_ptr<UniformBuffer> &buffer, const CameraUniformBlock &block)
+    {
+        GetRecordedFrame().m_cameras.push_back(CameraPacket{ buffer, block });
+    }
+
+    void RenderQueue::EndFrame()
+    {
+        (void)m_published_frame_count.fetch_add(1, std::memory_order_release);
+
+        (void)m_render_signal.fetch_add(1, std::memory_order_release);
+        m_render_signal.notify_one();
+    }
+
+    std::size_t RenderQueue::GetPacketCount() const
+    {
+        const std::uint64_t frame = m_published_frame_count.load(std::memory_order_relaxed);
+        const std::size_t count = m_frames[frame % k_frame_packet_count].m_draws.size();
+        return count;
+    }
+
+    // The signal is read before checking, so a publish or interruption that follows cannot be missed.
+    bool RenderQueue::WaitForFrame()
+    {
+        while (true)
+        {
+            const std::uint32_t signal = m_render_signal.load(std::memory_order_acquire);
+
+            const bool is_frame_published = (m_executed_frame_count.load(std::memory_order_relaxed)
+                                             < m_published_frame_count.load(std::memory_order_acquire));
+            if (is_frame_published)
+            {
+                return true;
+            }
+
+            if (m_is_wait_interrupted.exchange(false, std::memory_order_acq_rel))
+            {
+                return false;
+            }
+
+            m_render_signal.wait(signal, std::memory_order_acquire);
+        }
+    }
+
+    void RenderQueue::InterruptWait()
+    {
+        m_is_wait_interrupted.store(true, std::memory_order_release);
+
+        (void)m_render_signal.fetch_add(1, std::memory_order_release);
+        m_render_signal.notify_one();
+    }
+
+    void RenderQueue::Execute()
+    {
+        const std::uint64_t frame = m_executed_frame_count.load(std::memory_order_relaxed);
+        if (frame == m_published_frame_count.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        FramePacket &frame_packet = m_frames[frame % k_frame_packet_count];
+        std::vector<DrawPacket> &draws = frame_packet.m_draws;
+
+        for (const auto &camera_packet : frame_packet.m_cameras)
+        {
+            camera_packet.m_buffer->Update(&camera_packet.m_uniform_block, sizeof(camera_packet.m_uniform_block));
+        }
+
+        RadixSortPackets(draws, m_sort_buffer);
+
+        m_bound_material = nullptr;
+        m_bound_program = 0;
+        m_bound_texture = 0;
+
+        std::size_t first = 0;
+
+        while (first < draws.size())
+        {
+            const std::size_t last = FindInstancedBatchEnd(draws, first);
+
+            if ((last - first) >= k_min_instanced_batch_size)
+            {
+                DrawInstancedBatch(draws, first, last);
+            }
+            else
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    DrawPacketAlone(draws[i]);
+                }
+            }
+
+            first = last;
+        }
+
+        // Releases the packets' share of what they drew with.
+        draws.clear();
+        frame_packet.m_cameras.clear();
+        m_bound_material = nullptr;
+
+        RunPendingReleases();
+
+        (void)m_executed_frame_count.fetch_add(1, std::memory_order_release);
+        m_executed_frame_count.notify_one();
+    }
+
+    void RenderQueue::SetRenderingThread(const std::thread::id thread)
+    {
+        m_rendering_thread.store(thread, std::memory_order_release);
+    }
+
+    bool RenderQueue::IsOnRenderingThread() const
+    {
+        const bool is_on_rendering_thread = (m_rendering_thread.load(std::memory_order_acquire) == std::this_thread::get_id());
+        return is_on_rendering_thread;
+    }
+
+    // Only a thread can make itself the rendering thread, so the check cannot become stale before
+    // the release runs on this one.
+    void RenderQueue::ReleaseGPUObject(std::function<void(IGraphicsAPI &)> &&release)
+    {
+        if (IsOnRenderingThread())
+        {
+            release(GraphicsAPISingleton::GetInstance().GetGraphicsAPI());
+            return;
+        }
+
+        const std::lock_guard<std::mutex> lock(m_release_mutex);
+        m_pending_releases.push_back(std::move(release));
+    }
+
+    void RenderQueue::RunPendingReleases()
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        std::vector<std::function<void(IGraphicsAPI &)>> releases;
+        {
+            const std::lock_guard<std::mutex> lock(m_release_mutex);
+            releases.swap(m_pending_releases);
+        }
+
+        for (const auto &release : releases)
+        {
+            release(api);
+        }
+    }
+
+    void RenderQueue::CheckCanCreateGPUObject(const std::string &object_description) const
+    {
+        if (!IsOnRenderingThread())
+        {
+            throw ExceptionWithStacktrace(object_description + " can only be created on the thread that renders. "
+                                          "Create it before the window runs pipelined.");
+        }
+    }
+
+    RenderQueue::FramePacket& RenderQueue::GetRecordedFrame()
+    {
+        const std::uint64_t frame = m_published_frame_count.load(std::memory_order_relaxed);
+
+        FramePacket &frame_packet = m_frames[frame % k_frame_packet_count];
+        return frame_packet;
+    }
+
+    // Packets with the same submesh and material are adjacent after sorting, since the key
+    // orders them by program, texture and VAO before depth.
+    std::size_t RenderQueue::FindInstancedBatchEnd(const std::vector<DrawPacket> &draws, const std::size_t first) const
+    {
+        const DrawPacket &first_packet = draws[first];
+        const DrawMaterial &first_material = *first_packet.m_material;
+
+        std::size_t last = first + 1;
+
+        if (first_material.m_instanced_program_id == 0)
+        {
+            return last;
+        }
+
+        while ((last < draws.size())
+               && (draws[last].m_submesh == first_packet.m_submesh)
+               && HasSameMaterial(first_material, *draws[last].m_material))
+        {
+            ++last;
+        }
+
+        return last;
+    }
+
+    void RenderQueue::DrawInstancedBatch(const std::vector<DrawPacket> &draws, const std::size_t first, const std::size_t last)
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        const DrawMaterial &material = *draws[first].m_material;
+
+        BindMaterial(material, material.m_instanced_program_id);
+
+        m_instance_matrices.clear();
+        for (std::size_t i = first; i < last; ++i)
+        {
+            m_instance_matrices.push_back(draws[i].m_model_matrix);
+        }
+
+        api.DrawSubMeshInstanced(*draws[first].m_submesh, m_instance_matrices);
+    }
+
+    void RenderQueue::DrawPacketAlone(const DrawPacket &packet)
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        const DrawMaterial &material = *packet.m_material;
+
+        BindMaterial(material, material.m_program_id);
+
+        if (material.m_model_uniform.IsValid())
+        {
+            api.SetShaderUniformMatrix4x4(material.m_model_uniform, packet.m_model_matrix);
+        }
+
+        api.DrawSubMesh(*packet.m_submesh);
+    }
+
+    // Uniform values are stored per program, so everything is set again after a program switch.
+    void RenderQueue::BindMaterial(const DrawMaterial &material, const TShaderProgramID program)
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        const bool is_program_changed = (m_bound_material == nullptr) || (program != m_bound_program);
+        if (is_program_changed)
+        {
+            api.UseShader(program);
+        }
+
+        if (is_program_changed || !HasSameMaterial(material, *m_bound_material))
+        {
+            if (material.m_camera_buffer != nullptr)
+            {
+                material.m_camera_buffer->Bind(ShaderConstants::k_camera_uniform_block_binding);
+            }
+
+            if (material.m_light_position_uniform.IsValid())
+            {
+                api.SetShaderUniformVector3(material.m_light_position_uniform, material.m_light_position);
+            }
+        }
+
+        const bool is_texture_changed = is_program_changed || (material.m_texture_id != m_bound_texture);
+        if (is_texture_changed && (material.m_texture_id != 0))
+        {
+            api.BindTexture(material.m_texture_id, 0U);
+        }
+
+        m_bound_material = &material;
+        m_bound_program = program;
+        m_bound_texture = material.m_texture_id;
+    }
+}
@@ -0,0 +1,155 @@
+#ifndef MG3TR_SRC_GRAPHICS_RENDERQUEUE_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_RENDERQUEUE_HPP_INCLUDED
+
+#include <Graphics/API/GraphicsTypes.hpp>
+#include <Graphics/CameraUniformBlock.hpp>
+#include <Graphics/DrawMaterial.hpp>
+#include <Graphics/RenderPass.hpp>
+#include <Math/Matrix4x4.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MG3TR
+{
+    class IGraphicsAPI;
+    class SubMesh;
+    class UniformBuffer;
+
+    // Shares ownership of everything it draws with, so the scene may release any of it while the
+    // frame is still pending.
+    struct DrawPacket
+    {
+        std::uint64_t m_sort_key;
+        std::shared_ptr<const DrawMaterial> m_material;
+        std::shared_ptr<const SubMesh> m_submesh;
+        // World model matrix of the object when the draw was submitted.
+        Matrix4x4 m_model_matrix;
+    };
+
+    // Collects the draws of a frame, sorts them by key and submits them in order.
+    // Key layout, from the most significant bit:
+    //   pass (4 bits) | program (10 bits) | texture (14 bits) | VAO (12 bits) | depth (24 bits)
+    // IDs wider than their field are truncated, which only affects how well draws are grouped.
+    //
+    // After sorting, runs of packets that draw the same submesh with the same material are drawn
+    // with a single instanced call, provided their material has an instanced program.
+    //
+    // The thread that runs the scene records each frame into a frame packet, between BeginFrame
+    // and EndFrame, and the thread that renders executes the packets in order. The two only share
+    // the counts of published and executed frames, so the packets form a lock free ring. With two
+    // packets, the scene records a frame while the previous one is drawn, and BeginFrame waits
+    // when the scene gets a whole frame ahead. Both sides may also be the same thread.
+    //
+    // Cameras submit the uniform block they had when the frame was recorded, and draws their
+    // model matrix and material, so the rendering thread never reads the scene. The GPU objects the
+    // packets share are released by Execute, on the rendering thread, once the frame is drawn.
+    //
+    // GPU objects destroyed on any other thread hand their release to the queue, which runs it on
+    // the rendering thread after the next frame it executes. Creating them needs the graphics
+    // context, so it is only allowed on the rendering thread.
+    class RenderQueue
+    {
+    private:
+        struct CameraPacket
+        {
+            std::shared_ptr<UniformBuffer> m_buffer;
+            CameraUniformBlock m_uniform_block;
+        };
+
+        struct FramePacket
+        {
+            std::vector<DrawPacket> m_draws;
+            std::vector<CameraPacket> m_cameras;
+        };
+
+        static constexpr std::size_t k_frame_packet_count = 2;
+
+        std::array<FramePacket, k_frame_packet_count> m_frames;
+        std::atomic<std::uint64_t> m_published_frame_count;
+        std::atomic<std::uint64_t> m_executed_frame_count;
+        // Changes whenever the rendering thread may have to stop waiting.
+        std::atomic<std::uint32_t> m_render_signal;
+        std::atomic<bool> m_is_wait_interrupted;
+
+        // The thread the graphics context is current on, or none while it is handed over.
+        std::atomic<std::thread::id> m_rendering_thread;
+        std::mutex m_release_mutex;
+        std::vector<std::function<void(IGraphicsAPI &)>> m_pending_releases;
+
+        // Only used by the rendering thread.
+        std::vector<DrawPacket> m_sort_buffer;
+        std::vector<Matrix4x4> m_instance_matrices;
+
+        // State left behind by the previous draw of the current Execute.
+        const DrawMaterial *m_bound_material;
+        TShaderProgramID m_bound_program;
+        TTextureID m_bound_texture;
+
+        static RenderQueue m_instance;
+
+        RenderQueue();
+        ~RenderQueue() = default;
+
+    public:
+        RenderQueue(const RenderQueue &) = delete;
+        RenderQueue(RenderQueue &&) = delete;
+
+        RenderQueue& operator=(const RenderQueue &) = delete;
+        RenderQueue& operator=(RenderQueue &&) = delete;
+
+        static RenderQueue& GetInstance();
+
+        // normalised_depth is the view depth divided by the far plane; smaller values are drawn first.
+        static std::uint64_t CreateSortKey(const RenderPass pass, const TShaderProgramID program,
+                                           const TTextureID texture, const TVAOID vao, const float normalised_depth);
+
+        // Called by the thread that runs the scene. Submissions must come between BeginFrame and EndFrame.
+        void BeginFrame();
+        void Submit(DrawPacket &&packet);
+        void SubmitCamera(const std::shared_ptr<UniformBuffer> &buffer, const CameraUniformBlock &block);
+        void EndFrame();
+
+        // Draws submitted to the frame being recorded.
+        std::size_t GetPacketCount() const;
+
+        // Called by the thread that renders. Waits until a frame is published and returns true, or
+        // returns false once InterruptWait is called.
+        bool WaitForFrame();
+        void InterruptWait();
+        // Draws the oldest published frame, if any, and hands its packet back to the scene.
+        void Execute();
+
+        // Called by the thread that makes the graphics context current, and with a default ID
+        // before it releases the context.
+        void SetRenderingThread(const std::thread::id thread);
+        bool IsOnRenderingThread() const;
+
+        // Called from any thread by GPU objects being destroyed. The release runs right away on the
+        // rendering thread, and after the next executed frame on any other.
+        void ReleaseGPUObject(std::function<void(IGraphicsAPI &)> &&release);
+        // Called by the rendering thread, which Execute already does after every frame.
+        void RunPendingReleases();
+        // Throws when called on a thread other than the rendering one, such as the thread that runs
+        // the scene while the window is pipelined.
+        void CheckCanCreateGPUObject(const std::string &object_description) const;
+
+    private:
+        FramePacket& GetRecordedFrame();
+
+        std::size_t FindInstancedBatchEnd(const std::vector<DrawPacket> &draws, const std::size_t first) const;
+        void DrawInstancedBatch(const std::vector<DrawPacket> &draws, const std::size_t first, const std::size_t last);
+        void DrawPacketAlone(const DrawPacket &packet);
+        void BindMaterial(const DrawMaterial &material, const TShaderProgramID program);
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_RENDERQUEUE_HPP_INCLUDED
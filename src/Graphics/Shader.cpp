@@ -1,124 +1,86 @@
 #include "Shader.hpp"
 
+#include <Constants/GraphicsConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/ShaderConstants.hpp>
-#include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/ShaderProgramCache.hpp>
 #include <Serialisation/IDeserialiser.hpp>
 #include <Serialisation/ISerialiser.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 #include <Utils/ProjDirOperations.hpp>
 
-#include <fstream>
-#include <iterator>
+#include <utility>
 
-static std::string ReadFileInString(const std::string &file_name)
+namespace MG3TR
 {
-    std::ifstream input_stream(file_name);
-
-    if (input_stream.fail())
+    Shader::Shader()
+        : m_program(),
+          m_instanced_program(),
+          m_supports_instancing(false),
+          m_draw_material()
     {
-        throw MG3TR::ExceptionWithStacktrace("Could not open \"" + file_name + "\".");
-    }
 
-    const std::string file_content(std::istreambuf_iterator<char>{input_stream}, {});
-    return file_content;
-}
+    }
 
-namespace MG3TR
-{
     Shader::Shader(const std::string &vertex_shader_path, const std::string &fragment_shader_path)
+        : Shader()
     {
         Construct(vertex_shader_path, fragment_shader_path);
     }
     
     Shader::Shader(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
                    const std::string &fragment_shader_path)
+        : Shader()
     {
         Construct(vertex_shader_path, geometry_shader_path, fragment_shader_path);
     }
     
-    Shader::~Shader()
-    {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-
-        if (m_vertex_shader > 0)
-        {
-            api.DeleteShader(m_program, m_vertex_shader);
-        }
-
-        if (m_geometry_shader > 0)
-        {
-            api.DeleteShader(m_program, m_geometry_shader);
-        }
-
-        if (m_fragment_shader > 0)
-        {
-            api.DeleteShader(m_program, m_fragment_shader);
-
-        }
-
-        if (m_program > 0)
-        {
-            api.DeleteShaderProgram(m_program);
-        }
-    }
-
-    Shader::Shader(const Shader &other)
-    {
-        CopyFrom(other);
-    }
-
-    Shader::Shader(Shader &&other)
-    {
-        MoveFrom(std::move(other));
-    }
-
-    Shader& Shader::operator=(const Shader &other)
-    {
-        CopyFrom(other);
-        return *this;
-    }
-
-    Shader& Shader::operator=(Shader &&other)
-    {
-        MoveFrom(std::move(other));
-        return *this;
-    }
-
     TShaderID Shader::GetVertexShader() const
     {
-        return m_vertex_shader;
+        const TShaderID vertex_shader = (m_program != nullptr) ? m_program->GetVertexShader() : 0;
+        return vertex_shader;
     }
 
     TShaderID Shader::GetGeometryShader() const
     {
-        return m_geometry_shader;
+        const TShaderID geometry_shader = (m_program != nullptr) ? m_program->GetGeometryShader() : 0;
+        return geometry_shader;
     }
 
     TShaderID Shader::GetFragmentShader() const
     {
-        return m_fragment_shader;
+        const TShaderID fragment_shader = (m_program != nullptr) ? m_program->GetFragmentShader() : 0;
+        return fragment_shader;
     }
 
     TShaderProgramID Shader::GetProgram() const
     {
-        return m_program;
+        const TShaderProgramID program = (m_program != nullptr) ? m_program->GetProgram() : 0;
+        return program;
     }
     
-    void Shader::Use() const
+    TShaderProgramID Shader::GetInstancedProgram() const
     {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-        api.UseShader(m_program);
+        const TShaderProgramID program = (m_instanced_program != nullptr) ? m_instanced_program->GetProgram() : 0;
+        return program;
     }
 
-    void Shader::SetUniforms()
+    RenderPass Shader::GetRenderPass() const
     {
-
+        return RenderPass::Opaque;
     }
 
-    void Shader::BindAdditionals()
+    const std::shared_ptr<const DrawMaterial>& Shader::GetDrawMaterial()
     {
+        if (m_draw_material == nullptr)
+        {
+            auto material = std::make_shared<DrawMaterial>();
+            FillDrawMaterial(*material);
+
+            m_draw_material = std::move(material);
+        }
 
+        return m_draw_material;
     }
 
     void Shader::Serialise(ISerialiser &serialiser)
@@ -171,6 +133,33 @@ namespace MG3TR
     {
 
     }
+
+    void Shader::EnableInstancing()
+    {
+        m_supports_instancing = true;
+
+        if ((m_instanced_program == nullptr) && (m_program != nullptr))
+        {
+            auto& cache = ShaderProgramCache::GetInstance();
+            m_instanced_program = cache.GetProgram(m_vertex_shader_path, m_geometry_shader_path, m_fragment_shader_path,
+                                                   { ShaderConstants::k_instanced_define });
+        }
+
+        InvalidateDrawMaterial();
+    }
+
+    void Shader::FillDrawMaterial(DrawMaterial &material) const
+    {
+        material.m_program = m_program;
+        material.m_instanced_program = m_instanced_program;
+        material.m_program_id = GetProgram();
+        material.m_instanced_program_id = GetInstancedProgram();
+    }
+
+    void Shader::InvalidateDrawMaterial()
+    {
+        m_draw_material = nullptr;
+    }
     
     void Shader::Construct(const std::string &vertex_shader_path, const std::string &fragment_shader_path)
     {
@@ -179,50 +168,25 @@ namespace MG3TR
             return;
         }
 
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-
-        m_vertex_shader_path = vertex_shader_path;
-        m_geometry_shader_path = "";
-        m_fragment_shader_path = fragment_shader_path;
-        m_vertex_shader = api.CreateShader(GPUShaderType::VertexShader, ReadFileInString(vertex_shader_path), vertex_shader_path);
-        m_geometry_shader = 0;
-        m_fragment_shader = api.CreateShader(GPUShaderType::FragmentShader, ReadFileInString(fragment_shader_path), fragment_shader_path);
-        m_program = api.CreateShaderProgram(m_vertex_shader, m_fragment_shader);
+        Construct(vertex_shader_path, "", fragment_shader_path);
     }
     
     void Shader::Construct(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
                            const std::string &fragment_shader_path)
     {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+        auto& cache = ShaderProgramCache::GetInstance();
 
         m_vertex_shader_path = vertex_shader_path;
         m_geometry_shader_path = geometry_shader_path;
         m_fragment_shader_path = fragment_shader_path;
-        m_vertex_shader = api.CreateShader(GPUShaderType::VertexShader, ReadFileInString(vertex_shader_path), vertex_shader_path);
-        m_geometry_shader = api.CreateShader(GPUShaderType::GeometryShader, ReadFileInString(geometry_shader_path), geometry_shader_path);
-        m_fragment_shader = api.CreateShader(GPUShaderType::FragmentShader, ReadFileInString(fragment_shader_path), fragment_shader_path);
-        m_program = api.CreateShaderProgram(m_vertex_shader, m_geometry_shader, m_fragment_shader);
-    }
+        m_program = cache.GetProgram(vertex_shader_path, geometry_shader_path, fragment_shader_path);
+        m_instanced_program = nullptr;
 
-    void Shader::CopyFrom(const Shader &other)
-    {
-        Construct(other.m_vertex_shader_path, other.m_geometry_shader_path, other.m_fragment_shader_path);
-    }
-
-    void Shader::MoveFrom(Shader &&other)
-    {
-        m_vertex_shader = other.m_vertex_shader;
-        m_geometry_shader = other.m_geometry_shader;
-        m_fragment_shader = other.m_fragment_shader;
-        m_program = other.m_program;
-
-        m_vertex_shader_path = std::move(other.m_vertex_shader_path);
-        m_geometry_shader_path = std::move(other.m_geometry_shader_path);
-        m_fragment_shader_path = std::move(other.m_fragment_shader_path);
+        if (m_supports_instancing)
+        {
+            EnableInstancing();
+        }
 
-        other.m_vertex_shader = 0;
-        other.m_geometry_shader = 0;
-        other.m_fragment_shader = 0;
-        other.m_program = 0;
+        InvalidateDrawMaterial();
     }
-}
\ No newline at end of file
+}
@@ -2,6 +2,10 @@
 #define MG3TR_SRC_GRAPHICS_SHADER_HPP_INCLUDED
 
 #include <Graphics/API/GraphicsTypes.hpp>
+#include <Graphics/API/UniformHandle.hpp>
+#include <Graphics/DrawMaterial.hpp>
+#include <Graphics/RenderPass.hpp>
+#include <Graphics/ShaderProgram.hpp>
 #include <Math/Vector2.hpp>
 #include <Math/Vector3.hpp>
 #include <Math/Vector4.hpp>
@@ -9,6 +13,7 @@
 #include <Scene/ILateBindable.hpp>
 #include <Serialisation/ISerialisable.hpp>
 
+#include <memory>
 #include <string>
 
 namespace MG3TR
@@ -16,53 +21,72 @@ namespace MG3TR
     class Shader : public ISerialisable, public ILateBindable
     {
     private:
-        TShaderID m_vertex_shader;
-        TShaderID m_geometry_shader;
-        TShaderID m_fragment_shader;
+        std::shared_ptr<ShaderProgram> m_program;
+        std::shared_ptr<ShaderProgram> m_instanced_program;
+        bool m_supports_instancing;
 
-        TShaderProgramID m_program;
+        // Built on first use and dropped whenever something it was built from changes.
+        std::shared_ptr<const DrawMaterial> m_draw_material;
 
         std::string m_vertex_shader_path;
         std::string m_geometry_shader_path;
         std::string m_fragment_shader_path;
 
     public:
-        Shader() = default;
+        Shader();
 
         Shader(const std::string &vertex_shader_path, const std::string &fragment_shader_path);
         Shader(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
                const std::string &fragment_shader_path);
 
-        virtual ~Shader();
+        virtual ~Shader() = default;
 
-        Shader(const Shader &);
-        Shader(Shader &&);
+        Shader(const Shader &) = default;
+        Shader(Shader &&) = default;
         
-        Shader& operator=(const Shader &);
-        Shader& operator=(Shader &&);
+        Shader& operator=(const Shader &) = default;
+        Shader& operator=(Shader &&) = default;
 
         TShaderID GetVertexShader() const;
         TShaderID GetGeometryShader() const;
         TShaderID GetFragmentShader() const;
 
         TShaderProgramID GetProgram() const;
-        
-        void Use() const;
 
-        virtual void SetUniforms();
-        virtual void BindAdditionals();
+        template <typename TValue>
+        UniformHandle<TValue> GetUniformHandle(const std::string &name) const
+        {
+            const UniformHandle<TValue> uniform = (m_program != nullptr) ? m_program->GetUniformHandle<TValue>(name)
+                                                                         : UniformHandle<TValue>();
+            return uniform;
+        }
+
+        // 0 if the shader does not support instancing.
+        TShaderProgramID GetInstancedProgram() const;
+
+        // Used to order draws.
+        virtual RenderPass GetRenderPass() const;
+
+        // What the render queue draws the shader with. Must be called on the thread that runs the scene.
+        const std::shared_ptr<const DrawMaterial>& GetDrawMaterial();
 
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
         virtual void LateBind(Scene &scene) override;
 
+    protected:
+        // Derived shaders that support instancing call this from their constructors. From then on, the
+        // instanced variant is compiled together with the program.
+        void EnableInstancing();
+
+        // Derived shaders add what they bind and set to what the base class fills.
+        virtual void FillDrawMaterial(DrawMaterial &material) const;
+        void InvalidateDrawMaterial();
+
     private:
         void Construct(const std::string &vertex_shader_path, const std::string &fragment_shader_path);
         void Construct(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
                        const std::string &fragment_shader_path);
-
-        void CopyFrom(const Shader &other);
-        void MoveFrom(Shader &&other);
     };
 }
 
@@ -0,0 +1,164 @@
+#include "ShaderProgram.hpp"
+
+#include <Constants/GraphicsConstants.hpp>
+#include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/RenderQueue.hpp>
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <fstream>
+#include <iterator>
+
+static std::string ReadFileInString(const std::string &file_name)
+{
+    std::ifstream input_stream(file_name);
+
+    if (input_stream.fail())
+    {
+        throw MG3TR::ExceptionWithStacktrace("Could not open \"" + file_name + "\".");
+    }
+
+    const std::string file_content(std::istreambuf_iterator<char>{input_stream}, {});
+    return file_content;
+}
+
+// GLSL requires #version to be the first directive, so the defines are placed right after it.
+static std::string InsertDefinesInShaderCode(const std::string &code, const std::vector<std::string> &defines)
+{
+    if (defines.empty())
+    {
+        return code;
+    }
+
+    std::string defines_block;
+
+    for (const auto &define : defines)
+    {
+        defines_block += "#define " + define + "\n";
+    }
+
+    const bool starts_with_version = code.starts_with("#version");
+    if (!starts_with_version)
+    {
+        return defines_block + code;
+    }
+
+    const std::size_t version_line_end = code.find('\n');
+    if (version_line_end == std::string::npos)
+    {
+        return code + "\n" + defines_block;
+    }
+
+    std::string result = code;
+    (void)result.insert(version_line_end + 1, defines_block);
+
+    return result;
+}
+
+static MG3TR::TShaderID CreateShaderFromFile(const MG3TR::GPUShaderType type, const std::string &path,
+                                             const std::vector<std::string> &defines)
+{
+    auto& api = MG3TR::GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+    const std::string code = InsertDefinesInShaderCode(ReadFileInString(path), defines);
+    const MG3TR::TShaderID shader = api.CreateShader(type, code, path);
+
+    return shader;
+}
+
+namespace MG3TR
+{
+    ShaderProgram::ShaderProgram(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
+                                 const std::string &fragment_shader_path, const std::vector<std::string> &defines)
+        : m_vertex_shader(0),
+          m_geometry_shader(0),
+          m_fragment_shader(0),
+          m_program(0)
+    {
+        RenderQueue::GetInstance().CheckCanCreateGPUObject("Shader program \"" + vertex_shader_path + "\"");
+
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        // Defines that follow the vertex format of the meshes apply to every program.
+        std::vector<std::string> all_defines = defines;
+        if (MeshConstants::k_use_octahedral_normals)
+        {
+            all_defines.push_back(ShaderConstants::k_octahedral_normals_define);
+        }
+
+        m_vertex_shader = CreateShaderFromFile(GPUShaderType::VertexShader, vertex_shader_path, all_defines);
+        m_fragment_shader = CreateShaderFromFile(GPUShaderType::FragmentShader, fragment_shader_path, all_defines);
+
+        const bool has_geometry_shader = !geometry_shader_path.empty();
+        if (has_geometry_shader)
+        {
+            m_geometry_shader = CreateShaderFromFile(GPUShaderType::GeometryShader, geometry_shader_path, all_defines);
+            m_program = api.CreateShaderProgram(m_vertex_shader, m_geometry_shader, m_fragment_shader);
+        }
+        else
+        {
+            m_program = api.CreateShaderProgram(m_vertex_shader, m_fragment_shader);
+        }
+
+        for (auto &uniform : api.GetActiveUniforms(m_program))
+        {
+            const std::string name = uniform.m_name;
+            m_uniforms.emplace(name, std::move(uniform));
+        }
+    }
+
+    ShaderProgram::~ShaderProgram()
+    {
+        RenderQueue::GetInstance().ReleaseGPUObject([program = m_program, vertex_shader = m_vertex_shader,
+                                                     geometry_shader = m_geometry_shader,
+                                                     fragment_shader = m_fragment_shader](IGraphicsAPI &api)
+        {
+            if (vertex_shader > 0)
+            {
+                api.DeleteShader(program, vertex_shader);
+            }
+
+            if (geometry_shader > 0)
+            {
+                api.DeleteShader(program, geometry_shader);
+            }
+
+            if (fragment_shader > 0)
+            {
+                api.DeleteShader(program, fragment_shader);
+            }
+
+            if (program > 0)
+            {
+                api.DeleteShaderProgram(program);
+            }
+        });
+    }
+
+    TShaderID ShaderProgram::GetVertexShader() const
+    {
+        return m_vertex_shader;
+    }
+
+    TShaderID ShaderProgram::GetGeometryShader() const
+    {
+        return m_geometry_shader;
+    }
+
+    TShaderID ShaderProgram::GetFragmentShader() const
+    {
+        return m_fragment_shader;
+    }
+
+    TShaderProgramID ShaderProgram::GetProgram() const
+    {
+        return m_program;
+    }
+
+    const UniformDescription* ShaderProgram::FindUniform(const std::string &name) const
+    {
+        const auto uniform_iterator = m_uniforms.find(name);
+        const UniformDescription *const uniform = (uniform_iterator != m_uniforms.end()) ? &uniform_iterator->second
+                                                                                          : nullptr;
+        return uniform;
+    }
+}
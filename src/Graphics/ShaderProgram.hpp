@@ -0,0 +1,71 @@
+#ifndef MG3TR_SRC_GRAPHICS_SHADERPROGRAM_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_SHADERPROGRAM_HPP_INCLUDED
+
+#include <Graphics/API/GraphicsTypes.hpp>
+#include <Graphics/API/UniformHandle.hpp>
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MG3TR
+{
+    // Owns the GPU objects of a linked program. Instances are shared between
+    // shaders through ShaderProgramCache and released with the last owner.
+    class ShaderProgram
+    {
+    private:
+        TShaderID m_vertex_shader;
+        TShaderID m_geometry_shader;
+        TShaderID m_fragment_shader;
+
+        TShaderProgramID m_program;
+
+        std::unordered_map<std::string, UniformDescription> m_uniforms;
+
+    public:
+        ShaderProgram(const std::string &vertex_shader_path, const std::string &geometry_shader_path,
+                      const std::string &fragment_shader_path, const std::vector<std::string> &defines);
+        virtual ~ShaderProgram();
+
+        ShaderProgram(const ShaderProgram &) = delete;
+        ShaderProgram(ShaderProgram &&) = delete;
+
+        ShaderProgram& operator=(const ShaderProgram &) = delete;
+        ShaderProgram& operator=(ShaderProgram &&) = delete;
+
+        TShaderID GetVertexShader() const;
+        TShaderID GetGeometryShader() const;
+        TShaderID GetFragmentShader() const;
+
+        TShaderProgramID GetProgram() const;
+
+        // Returns nullptr if the program has no active uniform with the given name.
+        const UniformDescription* FindUniform(const std::string &name) const;
+
+        // Missing uniforms yield an invalid handle, which the graphics API ignores.
+        template <typename TValue>
+        UniformHandle<TValue> GetUniformHandle(const std::string &name) const
+        {
+            const UniformDescription *const uniform = FindUniform(name);
+            if (uniform == nullptr)
+            {
+                return UniformHandle<TValue>();
+            }
+
+            constexpr GPUUniformType requested_type = GetUniformTypeOf<TValue>();
+            const bool is_sampler_set_as_int = (requested_type == GPUUniformType::Int)
+                                               && (uniform->m_type == GPUUniformType::Sampler);
+
+            if ((uniform->m_type != requested_type) && !is_sampler_set_as_int)
+            {
+                throw ExceptionWithStacktrace("Uniform \"" + name + "\" is used with a different type than declared.");
+            }
+
+            return UniformHandle<TValue>(uniform->m_location);
+        }
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_SHADERPROGRAM_HPP_INCLUDED
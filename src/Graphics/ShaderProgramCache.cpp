@@ -0,0 +1,70 @@
+#include "ShaderProgramCache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+static void CombineHash(std::size_t &seed, const std::string &value)
+{
+    const std::size_t hash = std::hash<std::string>{}(value);
+    seed ^= hash + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2);
+}
+
+namespace MG3TR
+{
+    std::size_t ShaderProgramKeyHash::operator()(const ShaderProgramKey &key) const
+    {
+        std::size_t seed = 0;
+
+        CombineHash(seed, key.m_vertex_shader_path);
+        CombineHash(seed, key.m_geometry_shader_path);
+        CombineHash(seed, key.m_fragment_shader_path);
+
+        for (const auto &define : key.m_defines)
+        {
+            CombineHash(seed, define);
+        }
+
+        return seed;
+    }
+
+    ShaderProgramCache ShaderProgramCache::m_instance;
+
+    ShaderProgramCache& ShaderProgramCache::GetInstance()
+    {
+        return m_instance;
+    }
+
+    std::shared_ptr<ShaderProgram> ShaderProgramCache::GetProgram(const std::string &vertex_shader_path,
+                                                                  const std::string &geometry_shader_path,
+                                                                  const std::string &fragment_shader_path,
+                                                                  const std::vector<std::string> &defines)
+    {
+        ShaderProgramKey key{ vertex_shader_path, geometry_shader_path, fragment_shader_path, defines };
+
+        const auto program_iterator = m_programs.find(key);
+        if (program_iterator != m_programs.end())
+        {
+            auto program = program_iterator->second.lock();
+            if (program != nullptr)
+            {
+                return program;
+            }
+        }
+
+        // Drop the entries of programs that are no longer used by any shader.
+        (void)std::erase_if(m_programs, [](const auto &entry) { return entry.second.expired(); });
+
+        auto program = std::make_shared<ShaderProgram>(vertex_shader_path, geometry_shader_path, fragment_shader_path, defines);
+        m_programs[std::move(key)] = program;
+
+        return program;
+    }
+
+    std::size_t ShaderProgramCache::GetLiveProgramCount() const
+    {
+        const auto live_count = std::count_if(m_programs.cbegin(), m_programs.cend(),
+                                              [](const auto &entry) { return !entry.second.expired(); });
+
+        return static_cast<std::size_t>(live_count);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef MG3TR_SRC_GRAPHICS_SHADERPROGRAMCACHE_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_SHADERPROGRAMCACHE_HPP_INCLUDED
+
+#include <Graphics/ShaderProgram.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MG3TR
+{
+    struct ShaderProgramKey
+    {
+        std::string m_vertex_shader_path;
+        std::string m_geometry_shader_path;
+        std::string m_fragment_shader_path;
+        std::vector<std::string> m_defines;
+
+        bool operator==(const ShaderProgramKey &other) const = default;
+    };
+
+    struct ShaderProgramKeyHash
+    {
+        std::size_t operator()(const ShaderProgramKey &key) const;
+    };
+
+    // Process wide registry of linked programs. The cache only keeps weak
+    // references, so a program lives as long as at least one shader uses it.
+    class ShaderProgramCache
+    {
+    private:
+        std::unordered_map<ShaderProgramKey, std::weak_ptr<ShaderProgram>, ShaderProgramKeyHash> m_programs;
+
+        static ShaderProgramCache m_instance;
+
+        ShaderProgramCache() = default;
+        ~ShaderProgramCache() = default;
+
+    public:
+        ShaderProgramCache(const ShaderProgramCache &) = delete;
+        ShaderProgramCache(ShaderProgramCache &&) = delete;
+
+        ShaderProgramCache& operator=(const ShaderProgramCache &) = delete;
+        ShaderProgramCache& operator=(ShaderProgramCache &&) = delete;
+
+        static ShaderProgramCache& GetInstance();
+
+        std::shared_ptr<ShaderProgram> GetProgram(const std::string &vertex_shader_path,
+                                                  const std::string &geometry_shader_path,
+                                                  const std::string &fragment_shader_path,
+                                                  const std::vector<std::string> &defines = {});
+
+        std::size_t GetLiveProgramCount() const;
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_SHADERPROGRAMCACHE_HPP_INCLUDED
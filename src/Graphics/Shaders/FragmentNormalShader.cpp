@@ -4,7 +4,6 @@
 #include <Constants/GraphicsConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/ShaderConstants.hpp>
-#include <Graphics/API/GraphicsAPISingleton.hpp>
 #include <Math/Matrix4x4.hpp>
 #include <Scene/Scene.hpp>
 #include <Scripting/Transform.hpp>
@@ -18,7 +17,8 @@ namespace MG3TR
         : Shader(MG3TR::ShaderConstants::k_fragment_normal_vertex_shader,
                  MG3TR::ShaderConstants::k_fragment_normal_fragment_shader)
     {
-
+        EnableInstancing();
+        ResolveUniformHandles();
     }
 
     FragmentNormalShader::FragmentNormalShader(const std::weak_ptr<Camera> &camera,
@@ -28,6 +28,9 @@ namespace MG3TR
           m_camera(camera),
           m_object_transform(object_transform)
     {
+        EnableInstancing();
+        ResolveUniformHandles();
+
         if (m_camera.lock() != nullptr)
         {
             m_camera_uid = camera.lock()->GetUID();
@@ -38,19 +41,6 @@ namespace MG3TR
         }
     }
 
-    void FragmentNormalShader::SetUniforms()
-    {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-        const auto program = GetProgram();
-        const auto model = m_object_transform.lock()->GetWorldModelMatrix();
-        const auto view = m_camera.lock()->GetViewMatrix();
-        const auto projection = m_camera.lock()->GetProjectionMatrix();
-
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_model_uniform_location, model);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_view_uniform_location, view);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_projection_uniform_location, projection);
-    }
-
     void FragmentNormalShader::Serialise(ISerialiser &serialiser)
     {
         Shader::Serialise(serialiser);
@@ -71,6 +61,7 @@ namespace MG3TR
     void FragmentNormalShader::Deserialise(IDeserialiser &deserialiser)
     {
         Shader::Deserialise(deserialiser);
+        ResolveUniformHandles();
 
         namespace Constants = FragmentNormalShaderSerialisationConstants;
 
@@ -91,5 +82,22 @@ namespace MG3TR
         {
             throw ExceptionWithStacktrace("Could not find object transform with UID " + std::to_string(m_object_transform_uid) + " in scene.");
         }
+
+        InvalidateDrawMaterial();
+    }
+
+    void FragmentNormalShader::FillDrawMaterial(DrawMaterial &material) const
+    {
+        Shader::FillDrawMaterial(material);
+
+        const auto camera = m_camera.lock();
+
+        material.m_camera_buffer = (camera != nullptr) ? camera->GetUniformBuffer() : nullptr;
+        material.m_model_uniform = m_model_uniform;
+    }
+
+    void FragmentNormalShader::ResolveUniformHandles()
+    {
+        m_model_uniform = GetUniformHandle<Matrix4x4>(ShaderConstants::k_model_uniform_location);
     }
 }
@@ -20,6 +20,8 @@ namespace MG3TR
         TUID m_camera_uid;
         TUID m_object_transform_uid;
 
+        UniformHandle<Matrix4x4> m_model_uniform;
+
     public:
         FragmentNormalShader();
         FragmentNormalShader(const std::weak_ptr<Camera> &camera, const std::weak_ptr<Transform> &object_transform);
@@ -31,11 +33,15 @@ namespace MG3TR
         FragmentNormalShader(FragmentNormalShader &&) = default;
         FragmentNormalShader& operator=(FragmentNormalShader &&) = default;
 
-        virtual void SetUniforms() override;
-
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
         virtual void LateBind(Scene &scene) override;
+
+    protected:
+        virtual void FillDrawMaterial(DrawMaterial &material) const override;
+
+    private:
+        void ResolveUniformHandles();
     };
 }
 
@@ -4,8 +4,8 @@
 #include <Constants/GraphicsConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/ShaderConstants.hpp>
-#include <Graphics/API/GraphicsAPISingleton.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureCache.hpp>
 #include <Scene/Scene.hpp>
 #include <Scripting/Transform.hpp>
 #include <Serialisation/IDeserialiser.hpp>
@@ -19,7 +19,8 @@ namespace MG3TR
         : Shader(ShaderConstants::k_texture_and_lighting_vertex_shader, 
                  ShaderConstants::k_texture_and_lighting_fragment_shader)
     {
-
+        EnableInstancing();
+        ResolveUniformHandles();
     }
 
     TextureAndLightingShader::TextureAndLightingShader(const std::weak_ptr<Camera> &camera,
@@ -33,6 +34,9 @@ namespace MG3TR
           m_texture(texture),
           m_light_position(light_position)
     {
+        EnableInstancing();
+        ResolveUniformHandles();
+
         if (m_camera.lock() != nullptr)
         {
             m_camera_uid = camera.lock()->GetUID();
@@ -43,26 +47,10 @@ namespace MG3TR
         }
     }
     
-    void TextureAndLightingShader::SetUniforms()
+    RenderPass TextureAndLightingShader::GetRenderPass() const
     {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-        const auto program = GetProgram();
-        const auto model = m_object_transform.lock()->GetWorldModelMatrix();
-        const auto view = m_camera.lock()->GetViewMatrix();
-        const auto projection = m_camera.lock()->GetProjectionMatrix();
-        const auto camera_world_position = m_camera.lock()->GetTransform().lock()->GetWorldPosition();
-
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_model_uniform_location, model);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_view_uniform_location, view);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_projection_uniform_location, projection);
-
-        api.SetShaderUniformVector3(program, ShaderConstants::k_camera_position_uniform_location, camera_world_position);
-        api.SetShaderUniformVector3(program, ShaderConstants::k_light_position_uniform_location, m_light_position);
-    }
-    
-    void TextureAndLightingShader::BindAdditionals()
-    {
-        m_texture->Bind();
+        // The fragment shader discards transparent texels.
+        return RenderPass::AlphaTested;
     }
 
     void TextureAndLightingShader::Serialise(ISerialiser &serialiser)
@@ -89,6 +77,7 @@ namespace MG3TR
     void TextureAndLightingShader::Deserialise(IDeserialiser &deserialiser)
     {
         Shader::Deserialise(deserialiser);
+        ResolveUniformHandles();
 
         namespace Constants = TextureAndLightingShaderSerialisationConstants;
 
@@ -98,7 +87,7 @@ namespace MG3TR
 
         const std::string relative_texture_path = deserialiser.DeserialiseString(Constants::k_texture_path_attribute);
         const std::string texture_path = AddProjDirToPath(relative_texture_path);
-        m_texture = std::make_shared<Texture>(texture_path);
+        m_texture = TextureCache::GetInstance().GetTexture(texture_path);
     }
 
     void TextureAndLightingShader::LateBind(Scene &scene)
@@ -114,5 +103,27 @@ namespace MG3TR
         {
             throw ExceptionWithStacktrace("Could not find object transform with UID " + std::to_string(m_camera_uid) + " in scene.");
         }
+
+        InvalidateDrawMaterial();
+    }
+
+    void TextureAndLightingShader::FillDrawMaterial(DrawMaterial &material) const
+    {
+        Shader::FillDrawMaterial(material);
+
+        const auto camera = m_camera.lock();
+
+        material.m_camera_buffer = (camera != nullptr) ? camera->GetUniformBuffer() : nullptr;
+        material.m_texture = m_texture;
+        material.m_texture_id = m_texture->GetID();
+        material.m_model_uniform = m_model_uniform;
+        material.m_light_position_uniform = m_light_position_uniform;
+        material.m_light_position = m_light_position;
+    }
+
+    void TextureAndLightingShader::ResolveUniformHandles()
+    {
+        m_model_uniform = GetUniformHandle<Matrix4x4>(ShaderConstants::k_model_uniform_location);
+        m_light_position_uniform = GetUniformHandle<Vector3>(ShaderConstants::k_light_position_uniform_location);
     }
 }
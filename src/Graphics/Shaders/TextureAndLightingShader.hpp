@@ -24,6 +24,9 @@ namespace MG3TR
         TUID m_camera_uid;
         TUID m_object_transform_uid;
 
+        UniformHandle<Matrix4x4> m_model_uniform;
+        UniformHandle<Vector3> m_light_position_uniform;
+
     public:
         TextureAndLightingShader();
 
@@ -37,12 +40,17 @@ namespace MG3TR
         TextureAndLightingShader& operator=(const TextureAndLightingShader &) = default;
         TextureAndLightingShader& operator=(TextureAndLightingShader &&) = default;
 
-        virtual void SetUniforms() override;
-        virtual void BindAdditionals() override;
+        virtual RenderPass GetRenderPass() const override;
 
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
         virtual void LateBind(Scene &scene) override;
+
+    protected:
+        virtual void FillDrawMaterial(DrawMaterial &material) const override;
+
+    private:
+        void ResolveUniformHandles();
     };
 }
 
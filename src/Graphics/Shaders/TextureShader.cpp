@@ -4,8 +4,8 @@
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/ShaderConstants.hpp>
 #include <Components/Camera.hpp>
-#include <Graphics/API/GraphicsAPISingleton.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureCache.hpp>
 #include <Scene/Scene.hpp>
 #include <Scripting/Transform.hpp>
 #include <Serialisation/IDeserialiser.hpp>
@@ -18,32 +18,24 @@ namespace MG3TR
     TextureShader::TextureShader()
         : Shader(ShaderConstants::k_texture_vertex_shader, ShaderConstants::k_texture_fragment_shader)
     {
-
+        EnableInstancing();
+        ResolveUniformHandles();
     }
 
     TextureShader::TextureShader(const std::weak_ptr<Camera> &camera, const std::weak_ptr<Transform> &object_transform,
                                  const std::shared_ptr<Texture> &texture)
         : Shader(ShaderConstants::k_texture_vertex_shader, ShaderConstants::k_texture_fragment_shader)
     {
+        EnableInstancing();
+        ResolveUniformHandles();
+
         Construct(camera, object_transform, texture);
     }
 
-    void TextureShader::SetUniforms()
+    RenderPass TextureShader::GetRenderPass() const
     {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-        const auto program = GetProgram();
-        const auto model = m_object_transform.lock()->GetWorldModelMatrix();
-        const auto view = m_camera.lock()->GetViewMatrix();
-        const auto projection = m_camera.lock()->GetProjectionMatrix();
-
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_model_uniform_location, model);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_view_uniform_location, view);
-        api.SetShaderUniformMatrix4x4(program, ShaderConstants::k_projection_uniform_location, projection);
-    }
-    
-    void TextureShader::BindAdditionals()
-    {
-        m_texture->Bind();
+        // The fragment shader discards transparent texels.
+        return RenderPass::AlphaTested;
     }
 
     void TextureShader::Serialise(ISerialiser &serialiser)
@@ -69,6 +61,7 @@ namespace MG3TR
     void TextureShader::Deserialise(IDeserialiser &deserialiser)
     {
         Shader::Deserialise(deserialiser);
+        ResolveUniformHandles();
 
         namespace Constants = TextureShaderSerialisationConstants;
 
@@ -77,7 +70,7 @@ namespace MG3TR
 
         const std::string relative_texture_path = deserialiser.DeserialiseString(Constants::k_texture_path_attribute);
         const std::string texture_path = AddProjDirToPath(relative_texture_path);
-        m_texture = std::make_shared<Texture>(texture_path);
+        m_texture = TextureCache::GetInstance().GetTexture(texture_path);
     }
 
     void TextureShader::LateBind(Scene &scene)
@@ -93,6 +86,8 @@ namespace MG3TR
         {
             throw ExceptionWithStacktrace("Could not find object transform with UID " + std::to_string(m_camera_uid) + " in scene.");
         }
+
+        InvalidateDrawMaterial();
     }
     
     void TextureShader::Construct(const std::weak_ptr<Camera> &camera, const std::weak_ptr<Transform> &object_transform,
@@ -111,4 +106,21 @@ namespace MG3TR
             m_object_transform_uid = m_object_transform.lock()->GetUID();
         }
     }
+
+    void TextureShader::FillDrawMaterial(DrawMaterial &material) const
+    {
+        Shader::FillDrawMaterial(material);
+
+        const auto camera = m_camera.lock();
+
+        material.m_camera_buffer = (camera != nullptr) ? camera->GetUniformBuffer() : nullptr;
+        material.m_texture = m_texture;
+        material.m_texture_id = m_texture->GetID();
+        material.m_model_uniform = m_model_uniform;
+    }
+
+    void TextureShader::ResolveUniformHandles()
+    {
+        m_model_uniform = GetUniformHandle<Matrix4x4>(ShaderConstants::k_model_uniform_location);
+    }
 }
@@ -22,6 +22,8 @@ namespace MG3TR
         TUID m_camera_uid;
         TUID m_object_transform_uid;
 
+        UniformHandle<Matrix4x4> m_model_uniform;
+
     public:
         TextureShader();
 
@@ -35,14 +37,17 @@ namespace MG3TR
         TextureShader& operator=(const TextureShader &) = default;
         TextureShader& operator=(TextureShader &&) = default;
 
-        virtual void SetUniforms() override;
-        virtual void BindAdditionals() override;
+        virtual RenderPass GetRenderPass() const override;
 
         virtual void Serialise(ISerialiser &serialiser) override;
         virtual void Deserialise(IDeserialiser &deserialiser) override;
         virtual void LateBind(Scene &scene) override;
 
+    protected:
+        virtual void FillDrawMaterial(DrawMaterial &material) const override;
+
     private:
+        void ResolveUniformHandles();
         void Construct(const std::weak_ptr<Camera> &camera, const std::weak_ptr<Transform> &object_transform,
                        const std::shared_ptr<Texture> &texture);
     };
@@ -2,30 +2,130 @@
 
 #include <Constants/GraphicsConstants.hpp>
 #include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
+#include <glm/gtc/packing.hpp>
 
-template <typename TVector>
-static MG3TR::TVBOID CreateVBO(const std::vector<TVector> &std_vector, const unsigned location)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Full precision attributes are copied straight from the math types.
+static_assert(sizeof(MG3TR::Vector2) == 2 * sizeof(float));
+static_assert(sizeof(MG3TR::Vector3) == 3 * sizeof(float));
+
+static float SignNotZero(const float value)
 {
-    const void *const std_vector_pointer = reinterpret_cast<const void*>(&std_vector[0]);
-    const std::size_t std_vector_size = sizeof(std_vector[0]) * std_vector.size();
-    const std::size_t vector_size = TVector::Size();
+    const float sign = (value >= 0.0F) ? 1.0F : -1.0F;
+    return sign;
+}
 
-    auto& api = MG3TR::GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-    const MG3TR::TVBOID vbo = api.CreateVBO(std_vector_pointer, std_vector_size, vector_size, location);
+// Projects the direction onto the octahedron |x| + |y| + |z| = 1 and folds the lower half
+// over the upper one, so that it fits in two components in [-1, 1].
+static std::array<std::uint16_t, 2> EncodeOctahedralNormal(const MG3TR::Vector3 &normal)
+{
+    const float l1_norm = std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z());
+    const float scale = (l1_norm > 0.0F) ? (1.0F / l1_norm) : 0.0F;
 
-    return vbo;
+    float u = normal.x() * scale;
+    float v = normal.y() * scale;
+
+    if (normal.z() < 0.0F)
+    {
+        const float folded_u = (1.0F - std::abs(v)) * SignNotZero(u);
+        const float folded_v = (1.0F - std::abs(u)) * SignNotZero(v);
+
+        u = folded_u;
+        v = folded_v;
+    }
+
+    const std::array<std::uint16_t, 2> encoded{ glm::packSnorm1x16(u), glm::packSnorm1x16(v) };
+    return encoded;
 }
 
-static MG3TR::TIBOID CreateIBO(const std::vector<unsigned> &indices)
+static void WriteVector3(unsigned char *const destination, const MG3TR::GPUAttributeFormat format,
+                         const MG3TR::Vector3 &value)
 {
-    const void *const indices_pointer = reinterpret_cast<const void*>(&indices[0]);
-    const std::size_t indices_size = sizeof(indices[0]) * indices.size();
+    if (format == MG3TR::GPUAttributeFormat::Snorm16x2)
+    {
+        const std::array<std::uint16_t, 2> encoded = EncodeOctahedralNormal(value);
+        (void)std::memcpy(destination, encoded.data(), sizeof(encoded));
+    }
+    else
+    {
+        (void)std::memcpy(destination, &value, sizeof(value));
+    }
+}
 
+static void WriteVector2(unsigned char *const destination, const MG3TR::GPUAttributeFormat format,
+                         const MG3TR::Vector2 &value)
+{
+    if (format == MG3TR::GPUAttributeFormat::Half2)
+    {
+        const std::array<std::uint16_t, 2> components{ glm::packHalf1x16(value.x()), glm::packHalf1x16(value.y()) };
+        (void)std::memcpy(destination, components.data(), sizeof(components));
+    }
+    else
+    {
+        (void)std::memcpy(destination, &value, sizeof(value));
+    }
+}
+
+// Vertices without a normal or UV get zeroes for the missing attribute.
+static std::vector<unsigned char> InterleaveVertices(const std::vector<MG3TR::Vector3> &vertices,
+                                                     const std::vector<MG3TR::Vector3> &normals,
+                                                     const std::vector<MG3TR::Vector2> &uvs,
+                                                     const MG3TR::VertexLayout &layout)
+{
+    const std::size_t stride = layout.GetStride();
+    std::vector<unsigned char> data(vertices.size() * stride);
+
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+        unsigned char *const vertex = data.data() + i * stride;
+
+        for (const auto &attribute : layout.GetAttributes())
+        {
+            unsigned char *const destination = vertex + attribute.m_offset;
+
+            if (attribute.m_location == MG3TR::MeshConstants::k_vertices_location)
+            {
+                WriteVector3(destination, attribute.m_format, vertices[i]);
+            }
+            else if (attribute.m_location == MG3TR::MeshConstants::k_normals_location)
+            {
+                const MG3TR::Vector3 normal = (i < normals.size()) ? normals[i] : MG3TR::Vector3();
+                WriteVector3(destination, attribute.m_format, normal);
+            }
+            else if (attribute.m_location == MG3TR::MeshConstants::k_uvs_location)
+            {
+                const MG3TR::Vector2 uv = (i < uvs.size()) ? uvs[i] : MG3TR::Vector2();
+                WriteVector2(destination, attribute.m_format, uv);
+            }
+        }
+    }
+
+    return data;
+}
+
+static MG3TR::TIBOID CreateIBO(const std::vector<unsigned> &indices, const MG3TR::GPUIndexType index_type)
+{
     auto& api = MG3TR::GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-    MG3TR::TIBOID ibo = api.CreateIBO(indices_pointer, indices_size);
 
+    if (index_type == MG3TR::GPUIndexType::UInt16)
+    {
+        std::vector<std::uint16_t> short_indices(indices.size());
+        (void)std::transform(indices.cbegin(), indices.cend(), short_indices.begin(),
+                             [](const unsigned index) { return static_cast<std::uint16_t>(index); });
+
+        const MG3TR::TIBOID ibo = api.CreateIBO(short_indices.data(), sizeof(short_indices[0]) * short_indices.size());
+        return ibo;
+    }
+
+    const MG3TR::TIBOID ibo = api.CreateIBO(indices.data(), sizeof(indices[0]) * indices.size());
     return ibo;
 }
 
@@ -40,6 +140,7 @@ namespace MG3TR
           m_uvs(uvs),
           m_indices(indices)
     {
+        ComputeBounds();
         Construct();
     }
 
@@ -52,29 +153,32 @@ namespace MG3TR
           m_uvs(uvs),
           m_indices(indices)
     {
+        ComputeBounds();
         Construct();
     }
     
     SubMesh::~SubMesh()
     {
-        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-
-        if (m_vbo_uvs > 0)
-        {
-            api.DeleteVBO(m_vbo_uvs);
-        }
-        if (m_vbo_normals > 0)
+        if ((m_ibo == 0) && (m_vbo == 0) && (m_vao == 0))
         {
-            api.DeleteVBO(m_vbo_normals);
+            return;
         }
-        if (m_vbo_vertices > 0)
-        {
-            api.DeleteVBO(m_vbo_vertices);
-        }
-        if (m_vao > 0)
+
+        RenderQueue::GetInstance().ReleaseGPUObject([ibo = m_ibo, vbo = m_vbo, vao = m_vao](IGraphicsAPI &api)
         {
-            api.DeleteVAO(m_vao);
-        }
+            if (ibo > 0)
+            {
+                api.DeleteIBO(ibo);
+            }
+            if (vbo > 0)
+            {
+                api.DeleteVBO(vbo);
+            }
+            if (vao > 0)
+            {
+                api.DeleteVAO(vao);
+            }
+        });
     }
 
     SubMesh::SubMesh(const SubMesh &other)
@@ -139,24 +243,24 @@ namespace MG3TR
         return m_indices;
     }
 
-    TVAOID SubMesh::GetVAO() const
+    BoundingBox SubMesh::GetBoundingBox() const
     {
-        return m_vao;
+        return m_bounding_box;
     }
 
-    TVBOID SubMesh::GetVBOVertices() const
+    Sphere SubMesh::GetBoundingSphere() const
     {
-        return m_vbo_vertices;
+        return m_bounding_sphere;
     }
 
-    TVBOID SubMesh::GetVBONormals() const
+    TVAOID SubMesh::GetVAO() const
     {
-        return m_vbo_normals;
+        return m_vao;
     }
 
-    TVBOID SubMesh::GetVBOUVs() const
+    TVBOID SubMesh::GetVBO() const
     {
-        return m_vbo_uvs;
+        return m_vbo;
     }
 
     TIBOID SubMesh::GetIBO() const
@@ -164,6 +268,37 @@ namespace MG3TR
         return m_ibo;
     }
 
+    GPUIndexType SubMesh::GetIndexType() const
+    {
+        return m_index_type;
+    }
+
+    std::size_t SubMesh::GetIndexCount() const
+    {
+        return m_indices.size();
+    }
+
+    VertexLayout SubMesh::CreateVertexLayout()
+    {
+        const GPUAttributeFormat normal_format = MeshConstants::k_use_octahedral_normals ? GPUAttributeFormat::Snorm16x2
+                                                                                         : GPUAttributeFormat::Float3;
+        const GPUAttributeFormat uv_format = MeshConstants::k_use_half_float_uvs ? GPUAttributeFormat::Half2
+                                                                                 : GPUAttributeFormat::Float2;
+
+        VertexLayout layout;
+        layout.AddAttribute(MeshConstants::k_vertices_location, GPUAttributeFormat::Float3);
+        layout.AddAttribute(MeshConstants::k_normals_location, normal_format);
+        layout.AddAttribute(MeshConstants::k_uvs_location, uv_format);
+
+        return layout;
+    }
+
+    void SubMesh::ComputeBounds()
+    {
+        m_bounding_box = BoundingBox::Enclosing(m_vertices);
+        m_bounding_sphere = Sphere::Enclosing(m_vertices);
+    }
+
     void SubMesh::Construct()
     {
         if (m_vertices.empty() || m_indices.empty())
@@ -171,15 +306,21 @@ namespace MG3TR
             throw ExceptionWithStacktrace("Cannot create mesh with no vertices or no triangles!");
         }
 
+        RenderQueue::GetInstance().CheckCanCreateGPUObject("Mesh");
+
         auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
 
-        m_vao = api.CreateVAO();
+        const VertexLayout layout = CreateVertexLayout();
+        const std::vector<unsigned char> vertex_data = InterleaveVertices(m_vertices, m_normals, m_uvs, layout);
 
-        m_vbo_vertices = CreateVBO(m_vertices, MeshConstants::k_vertices_location);
-        m_vbo_normals = CreateVBO(m_normals, MeshConstants::k_normals_location);
-        m_vbo_uvs = CreateVBO(m_uvs, MeshConstants::k_uvs_location);
+        const std::size_t max_short_indexed_vertices = std::size_t{std::numeric_limits<std::uint16_t>::max()} + 1U;
+        const bool can_use_short_indices = MeshConstants::k_use_16_bit_indices
+                                           && (m_vertices.size() <= max_short_indexed_vertices);
+        m_index_type = can_use_short_indices ? GPUIndexType::UInt16 : GPUIndexType::UInt32;
 
-        m_ibo = CreateIBO(m_indices);
+        m_vao = api.CreateVAO();
+        m_vbo = api.CreateVBO(vertex_data.data(), vertex_data.size(), layout);
+        m_ibo = CreateIBO(m_indices, m_index_type);
     }
     
     void SubMesh::CopyFrom(const SubMesh &other)
@@ -188,6 +329,8 @@ namespace MG3TR
         m_normals = other.m_normals;
         m_uvs = other.m_uvs;
         m_indices = other.m_indices;
+        m_bounding_box = other.m_bounding_box;
+        m_bounding_sphere = other.m_bounding_sphere;
         
         Construct();
     }
@@ -198,17 +341,16 @@ namespace MG3TR
         m_normals = std::move(other.m_normals);
         m_uvs = std::move(other.m_uvs);
         m_indices = std::move(other.m_indices);
+        m_bounding_box = other.m_bounding_box;
+        m_bounding_sphere = other.m_bounding_sphere;
 
         m_vao = other.m_vao;
-        m_vbo_vertices = other.m_vbo_vertices;
-        m_vbo_normals = other.m_vbo_normals;
-        m_vbo_uvs = other.m_vbo_uvs;
+        m_vbo = other.m_vbo;
         m_ibo = other.m_ibo;
+        m_index_type = other.m_index_type;
 
         other.m_vao = 0;
-        other.m_vbo_vertices = 0;
-        other.m_vbo_normals = 0;
-        other.m_vbo_uvs = 0;
+        other.m_vbo = 0;
         other.m_ibo = 0;
     }
 }
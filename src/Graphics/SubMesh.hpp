@@ -2,9 +2,14 @@
 #define MG3TR_SRC_GRAPHICS_SUBMESH_HPP_INCLUDED
 
 #include <Graphics/API/GraphicsTypes.hpp>
+#include <Graphics/API/VertexLayout.hpp>
+#include <Math/BoundingBox.hpp>
+#include <Math/Sphere.hpp>
 #include <Math/Vector2.hpp>
 #include <Math/Vector3.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace MG3TR
@@ -17,11 +22,15 @@ namespace MG3TR
         std::vector<Vector2> m_uvs;
         std::vector<unsigned> m_indices;
 
+        // In the space of the vertices, computed once on construction.
+        BoundingBox m_bounding_box;
+        Sphere m_bounding_sphere;
+
+        // The vertices are uploaded interleaved in a single buffer, see CreateVertexLayout.
         TVAOID m_vao;
-        TVBOID m_vbo_vertices;
-        TVBOID m_vbo_normals;
-        TVBOID m_vbo_uvs;
+        TVBOID m_vbo;
         TIBOID m_ibo;
+        GPUIndexType m_index_type;
 
     public:
         SubMesh(const std::vector<Vector3> &vertices,
@@ -54,13 +63,19 @@ namespace MG3TR
         std::vector<unsigned>& GetIndices();
         const std::vector<unsigned>& GetIndices() const;
 
+        BoundingBox GetBoundingBox() const;
+        Sphere GetBoundingSphere() const;
+
         TVAOID GetVAO() const;
-        TVBOID GetVBOVertices() const;
-        TVBOID GetVBONormals() const;
-        TVBOID GetVBOUVs() const;
+        TVBOID GetVBO() const;
         TIBOID GetIBO() const;
+        GPUIndexType GetIndexType() const;
+        std::size_t GetIndexCount() const;
+
+        static VertexLayout CreateVertexLayout();
 
     private:
+        void ComputeBounds();
         void Construct();
         void CopyFrom(const SubMesh &other);
         void MoveFrom(SubMesh &&other);
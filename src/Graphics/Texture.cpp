@@ -1,6 +1,7 @@
 #include "Texture.hpp"
 
 #include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -55,6 +56,8 @@ namespace MG3TR
             throw ExceptionWithStacktrace("Could not read image at \"" + path_to_file + "\".");
         }
 
+        RenderQueue::GetInstance().CheckCanCreateGPUObject("Texture \"" + path_to_file + "\"");
+
         auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
 
         m_id = api.CreateTexture(m_width, m_height, m_color_channels, m_image);
@@ -71,6 +74,20 @@ namespace MG3TR
     {
         return m_path_to_file;
     }
+
+    TTextureID Texture::GetID() const
+    {
+        return m_id;
+    }
+
+    std::size_t Texture::GetImageSize() const
+    {
+        const std::size_t image_size = static_cast<std::size_t>(m_width)
+                                       * static_cast<std::size_t>(m_height)
+                                       * static_cast<std::size_t>(m_color_channels);
+
+        return image_size;
+    }
     
     void Texture::FreeMemory()
     {
@@ -78,9 +95,7 @@ namespace MG3TR
 
         if (m_id > 0)
         {
-            auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
-
-            api.DeleteTexture(m_id);
+            RenderQueue::GetInstance().ReleaseGPUObject([texture_id = m_id](IGraphicsAPI &api) { api.DeleteTexture(texture_id); });
         }
 
         m_image = nullptr;
@@ -93,14 +108,14 @@ namespace MG3TR
         m_height = other.m_height;
         m_color_channels = other.m_color_channels;
 
-        const std::size_t image_size = static_cast<unsigned>(m_width)
-                                       * static_cast<unsigned>(m_height)
-                                       * static_cast<unsigned>(m_color_channels);
+        const std::size_t image_size = GetImageSize();
 
         m_image = static_cast<unsigned char *>(stbi__malloc(image_size));
 
         (void)std::memcpy(m_image, other.m_image, image_size);
 
+        RenderQueue::GetInstance().CheckCanCreateGPUObject("Texture \"" + other.m_path_to_file + "\"");
+
         auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
 
         m_id = api.CreateTexture(m_width, m_height, m_color_channels, m_image);
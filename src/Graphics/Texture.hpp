@@ -3,6 +3,7 @@
 
 #include <Graphics/API/GraphicsTypes.hpp>
 
+#include <cstddef>
 #include <string>
 
 namespace MG3TR
@@ -35,6 +36,8 @@ namespace MG3TR
         void Bind(const unsigned texture_unit_id = 0U);
 
         const std::string& GetPathToFile() const;
+        TTextureID GetID() const;
+        std::size_t GetImageSize() const;
 
     private:
         void FreeMemory();
@@ -0,0 +1,69 @@
+#include "TextureCache.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+static std::string CanonicalisePath(const std::string &path_to_file)
+{
+    const std::filesystem::path path(path_to_file);
+
+    std::error_code error_code;
+    const std::filesystem::path canonical_path = std::filesystem::weakly_canonical(path, error_code);
+
+    const std::string result = error_code ? path.lexically_normal().generic_string() : canonical_path.generic_string();
+    return result;
+}
+
+namespace MG3TR
+{
+    TextureCache TextureCache::m_instance;
+
+    TextureCache::TextureCache()
+        : m_saved_bytes(0)
+    {
+
+    }
+
+    TextureCache& TextureCache::GetInstance()
+    {
+        return m_instance;
+    }
+
+    std::shared_ptr<Texture> TextureCache::GetTexture(const std::string &path_to_file)
+    {
+        std::string key = CanonicalisePath(path_to_file);
+
+        const auto texture_iterator = m_textures.find(key);
+        if (texture_iterator != m_textures.end())
+        {
+            auto texture = texture_iterator->second.lock();
+            if (texture != nullptr)
+            {
+                m_saved_bytes += texture->GetImageSize();
+                return texture;
+            }
+        }
+
+        // Drop the entries of textures that are no longer used by anyone.
+        (void)std::erase_if(m_textures, [](const auto &entry) { return entry.second.expired(); });
+
+        auto texture = std::make_shared<Texture>(path_to_file);
+        m_textures[std::move(key)] = texture;
+
+        return texture;
+    }
+
+    std::size_t TextureCache::GetLiveTextureCount() const
+    {
+        const auto live_count = std::count_if(m_textures.cbegin(), m_textures.cend(),
+                                              [](const auto &entry) { return !entry.second.expired(); });
+
+        return static_cast<std::size_t>(live_count);
+    }
+
+    std::size_t TextureCache::GetSavedBytes() const
+    {
+        return m_saved_bytes;
+    }
+}
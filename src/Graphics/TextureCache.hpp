@@ -0,0 +1,45 @@
+#ifndef MG3TR_SRC_GRAPHICS_TEXTURECACHE_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_TEXTURECACHE_HPP_INCLUDED
+
+#include <Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace MG3TR
+{
+    // Process wide registry of textures keyed by canonical path. The cache only
+    // keeps weak references, so a texture lives as long as at least one owner uses it.
+    class TextureCache
+    {
+    private:
+        std::unordered_map<std::string, std::weak_ptr<Texture>> m_textures;
+
+        std::size_t m_saved_bytes;
+
+        static TextureCache m_instance;
+
+        TextureCache();
+        ~TextureCache() = default;
+
+    public:
+        TextureCache(const TextureCache &) = delete;
+        TextureCache(TextureCache &&) = delete;
+
+        TextureCache& operator=(const TextureCache &) = delete;
+        TextureCache& operator=(TextureCache &&) = delete;
+
+        static TextureCache& GetInstance();
+
+        std::shared_ptr<Texture> GetTexture(const std::string &path_to_file);
+
+        std::size_t GetLiveTextureCount() const;
+
+        // Bytes of decoded image data that were not loaded again thanks to cache hits.
+        std::size_t GetSavedBytes() const;
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_TEXTURECACHE_HPP_INCLUDED
@@ -0,0 +1,84 @@
+#include "UniformBuffer.hpp"
+
+#include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/RenderQueue.hpp>
+
+#include <utility>
+
+namespace MG3TR
+{
+    UniformBuffer::UniformBuffer()
+        : m_ubo(0),
+          m_memory_size(0)
+    {
+
+    }
+
+    UniformBuffer::~UniformBuffer()
+    {
+        FreeMemory();
+    }
+
+    UniformBuffer::UniformBuffer(UniformBuffer &&other)
+        : m_ubo(0),
+          m_memory_size(0)
+    {
+        MoveFrom(std::move(other));
+    }
+
+    UniformBuffer& UniformBuffer::operator=(UniformBuffer &&other)
+    {
+        FreeMemory();
+        MoveFrom(std::move(other));
+        return *this;
+    }
+
+    void UniformBuffer::Update(const void *const data, const std::size_t memory_size)
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        if (memory_size != m_memory_size)
+        {
+            FreeMemory();
+
+            RenderQueue::GetInstance().CheckCanCreateGPUObject("Uniform buffer");
+
+            m_ubo = api.CreateUBO(memory_size);
+            m_memory_size = memory_size;
+        }
+
+        api.UpdateUBO(m_ubo, data, memory_size);
+    }
+
+    void UniformBuffer::Bind(const unsigned binding_point) const
+    {
+        auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+        api.BindUBO(m_ubo, binding_point);
+    }
+
+    TUBOID UniformBuffer::GetUBO() const
+    {
+        return m_ubo;
+    }
+
+    void UniformBuffer::FreeMemory()
+    {
+        if (m_ubo > 0)
+        {
+            RenderQueue::GetInstance().ReleaseGPUObject([ubo = m_ubo](IGraphicsAPI &api) { api.DeleteUBO(ubo); });
+        }
+
+        m_ubo = 0;
+        m_memory_size = 0;
+    }
+
+    void UniformBuffer::MoveFrom(UniformBuffer &&other)
+    {
+        m_ubo = other.m_ubo;
+        m_memory_size = other.m_memory_size;
+
+        other.m_ubo = 0;
+        other.m_memory_size = 0;
+    }
+}
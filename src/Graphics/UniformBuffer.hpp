@@ -0,0 +1,39 @@
+#ifndef MG3TR_SRC_GRAPHICS_UNIFORMBUFFER_HPP_INCLUDED
+#define MG3TR_SRC_GRAPHICS_UNIFORMBUFFER_HPP_INCLUDED
+
+#include <Graphics/API/GraphicsTypes.hpp>
+
+#include <cstddef>
+
+namespace MG3TR
+{
+    // Owns a GPU uniform buffer. The buffer is created on the first upload, so
+    // instances can be built before the graphics API is initialised.
+    class UniformBuffer
+    {
+    private:
+        TUBOID m_ubo;
+        std::size_t m_memory_size;
+
+    public:
+        UniformBuffer();
+        virtual ~UniformBuffer();
+
+        UniformBuffer(const UniformBuffer &) = delete;
+        UniformBuffer(UniformBuffer &&);
+
+        UniformBuffer& operator=(const UniformBuffer &) = delete;
+        UniformBuffer& operator=(UniformBuffer &&);
+
+        void Update(const void *const data, const std::size_t memory_size);
+        void Bind(const unsigned binding_point) const;
+
+        TUBOID GetUBO() const;
+
+    private:
+        void FreeMemory();
+        void MoveFrom(UniformBuffer &&other);
+    };
+}
+
+#endif // MG3TR_SRC_GRAPHICS_UNIFORMBUFFER_HPP_INCLUDED
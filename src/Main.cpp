@@ -1,6 +1,7 @@
 ﻿#include <Constants/GraphicsConstants.hpp>
 #include <Components/Camera.hpp>
 #include <Components/CameraController.hpp>
+#include <Components/ComponentPool.hpp>
 #include <Components/MeshRenderer.hpp>
 #include <Components/SkyboxFollowCamera.hpp>
 #include <Components/TestRotation.hpp>
@@ -22,11 +23,15 @@
 #include <Scripting/GameObject.hpp>
 #include <Scripting/Transform.hpp>
 
+#include <Utils/JobSystem.hpp>
+
 #include <Window/Window.hpp>
 
 #include <memory>
+#include <thread>
 
 #define BUILD_SCENE_INSTEAD_OF_READING true
+#define DRAW_ON_SEPARATE_THREAD false
 
 #if BUILD_SCENE_INSTEAD_OF_READING
 
@@ -41,11 +46,11 @@ static std::shared_ptr<MG3TR::Camera> CreateCameraAndAddItToScene(MG3TR::Scene &
     MG3TR::Vector3 camera_position(0.0F, 3.0F, -5.0F);
     camera_transform->SetWorldPosition(camera_position);
 
-    auto camera = std::make_shared<MG3TR::Camera>(camera_game_object, camera_transform,
-                                                  90.0_rad, 4.0F / 3.0F, 0.001F, 300.0F);
+    auto camera = MG3TR::CreateComponent<MG3TR::Camera>(camera_game_object, camera_transform,
+                                                         90.0_rad, 4.0F / 3.0F, 0.001F, 300.0F);
     camera_game_object->AddComponent(camera);
 
-    auto camera_controller = std::make_shared<MG3TR::CameraController>(camera_game_object, camera_transform, 2.0F, 5.0F, 12.0F);
+    auto camera_controller = MG3TR::CreateComponent<MG3TR::CameraController>(camera_game_object, camera_transform, 2.0F, 5.0F, 12.0F);
     camera_game_object->AddComponent(camera_controller);
 
     return camera;
@@ -69,11 +74,11 @@ static std::shared_ptr<MG3TR::GameObject> CreateRotatingCubeAndAddItToScene(MG3T
     auto rotating_cube_mesh = std::make_shared<MG3TR::Mesh>(MG3TR::SceneConstants::k_cube_path);
     auto rotating_cube_shader = std::make_shared<MG3TR::FragmentNormalShader>(camera, rotating_cube_transform);
 
-    auto rotating_cube_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(rotating_cube_game_object, rotating_cube_transform,
-                                                                             rotating_cube_mesh, rotating_cube_shader, camera);
+    auto rotating_cube_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(rotating_cube_game_object, rotating_cube_transform,
+                                                                                    rotating_cube_mesh, rotating_cube_shader, camera);
     rotating_cube_game_object->AddComponent(rotating_cube_mesh_renderer);
 
-    auto rotating_script = std::make_shared<MG3TR::TestRotation>(rotating_cube_game_object, rotating_cube_transform);
+    auto rotating_script = MG3TR::CreateComponent<MG3TR::TestRotation>(rotating_cube_game_object, rotating_cube_transform);
     rotating_cube_game_object->AddComponent(rotating_script);
 
     return rotating_cube_game_object;
@@ -97,11 +102,11 @@ static std::shared_ptr<MG3TR::GameObject> CreateSecondRotatingCubeAndAddItAsChil
     auto second_rotating_cube_mesh = std::make_shared<MG3TR::Mesh>(MG3TR::SceneConstants::k_cube_path);
     auto second_rotating_cube_shader = std::make_shared<MG3TR::FragmentNormalShader>(camera, second_rotating_cube_transform);
 
-    auto second_rotating_cube_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(second_rotating_cube_game_object, second_rotating_cube_transform,
-                                                                                    second_rotating_cube_mesh, second_rotating_cube_shader, camera);
+    auto second_rotating_cube_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(second_rotating_cube_game_object, second_rotating_cube_transform,
+                                                                                           second_rotating_cube_mesh, second_rotating_cube_shader, camera);
     second_rotating_cube_game_object->AddComponent(second_rotating_cube_mesh_renderer);
 
-    auto rotating_script = std::make_shared<MG3TR::TestMovement>(second_rotating_cube_game_object, second_rotating_cube_transform);
+    auto rotating_script = MG3TR::CreateComponent<MG3TR::TestMovement>(second_rotating_cube_game_object, second_rotating_cube_transform);
     second_rotating_cube_game_object->AddComponent(rotating_script);
 
     return second_rotating_cube_game_object;
@@ -125,11 +130,11 @@ static std::shared_ptr<MG3TR::GameObject> CreateSkyBox(MG3TR::Scene &scene, std:
     auto skybox_texture = skybox_mesh->GetMaterials().begin()->m_diffuse_texture;
     auto skybox_shader = std::make_shared<MG3TR::TextureShader>(camera, skybox_transform, skybox_texture);
 
-    auto skybox_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(skybox_game_object, skybox_transform, skybox_mesh,
-                                                                      skybox_shader, camera, false);
+    auto skybox_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(skybox_game_object, skybox_transform, skybox_mesh,
+                                                                             skybox_shader, camera, false);
     skybox_game_object->AddComponent(skybox_mesh_renderer);
 
-    auto skybox_follow_camera = std::make_shared<MG3TR::SkyboxFollowCamera>(skybox_game_object, skybox_transform, camera->GetTransform());
+    auto skybox_follow_camera = MG3TR::CreateComponent<MG3TR::SkyboxFollowCamera>(skybox_game_object, skybox_transform, camera->GetTransform());
     skybox_game_object->AddComponent(skybox_follow_camera);
 
     return skybox_game_object;
@@ -156,8 +161,8 @@ static std::shared_ptr<MG3TR::GameObject> CreateCreeper(MG3TR::Scene &scene, std
     auto creeper_shader = std::make_shared<MG3TR::TextureAndLightingShader>(camera, creeper_transform,
                                                                             creeper_texture, k_light_position);
 
-    auto creeper_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(creeper_game_object, creeper_transform,
-                                                                       creeper_mesh, creeper_shader, camera);
+    auto creeper_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(creeper_game_object, creeper_transform,
+                                                                              creeper_mesh, creeper_shader, camera);
     creeper_game_object->AddComponent(creeper_mesh_renderer);
 
 
@@ -175,8 +180,8 @@ static std::shared_ptr<MG3TR::GameObject> CreateCreeper(MG3TR::Scene &scene, std
     auto sphere_mesh = std::make_shared<MG3TR::Mesh>(MG3TR::SceneConstants::k_sphere_path);
     auto sphere_shader = std::make_shared<MG3TR::FragmentNormalShader>(camera, sphere_transform);
 
-    auto sphere_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(sphere_game_object, sphere_transform,
-                                                                      sphere_mesh, sphere_shader, camera);
+    auto sphere_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(sphere_game_object, sphere_transform,
+                                                                             sphere_mesh, sphere_shader, camera);
     sphere_game_object->AddComponent(sphere_mesh_renderer);
 
     return creeper_game_object;
@@ -200,7 +205,7 @@ static std::shared_ptr<MG3TR::GameObject> CreateMap(MG3TR::Scene &scene, std::sh
     auto map_texture = map_mesh->GetMaterials().begin()->m_diffuse_texture;
     auto map_shader = std::make_shared<MG3TR::TextureAndLightingShader>(camera, map_transform, map_texture, k_light_position);
 
-    auto map_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(map_game_object, map_transform, map_mesh, map_shader, camera);
+    auto map_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(map_game_object, map_transform, map_mesh, map_shader, camera);
     map_game_object->AddComponent(map_mesh_renderer);
 
     return map_game_object;
@@ -225,8 +230,8 @@ static std::shared_ptr<MG3TR::GameObject> CreatePlanet(MG3TR::Scene &scene, std:
     auto planet_shader = std::make_shared<MG3TR::TextureAndLightingShader>(camera, planet_transform,
                                                                            planet_texture, k_light_position);
 
-    auto planet_mesh_renderer = std::make_shared<MG3TR::MeshRenderer>(planet_game_object, planet_transform,
-                                                                      planet_mesh, planet_shader, camera);
+    auto planet_mesh_renderer = MG3TR::CreateComponent<MG3TR::MeshRenderer>(planet_game_object, planet_transform,
+                                                                             planet_mesh, planet_shader, camera);
     planet_game_object->AddComponent(planet_mesh_renderer);
 
     return planet_game_object;
@@ -240,6 +245,8 @@ int main()
 
     api_instance.SetGraphicsAPI(std::move(opengl_api));
 
+    MG3TR::JobSystem::GetInstance().SetThreadCount(std::thread::hardware_concurrency());
+
     MG3TR::Window window(1024, 720, "MG3TR");
 
     auto scene = std::make_unique<MG3TR::Scene>();
@@ -261,6 +268,7 @@ int main()
 #   endif
 
     window.SetScene(std::move(scene));
+    window.SetPipelined(DRAW_ON_SEPARATE_THREAD);
 
     window.Initialize();
     window.KeepRunning();
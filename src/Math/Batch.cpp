@@ -0,0 +1,261 @@
+#include "Batch.hpp"
+
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define MG3TR_BATCH_X86 1
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC accepts every intrinsic without target flags.
+        #define MG3TR_TARGET_SSE4
+        #define MG3TR_TARGET_AVX2
+    #else
+        #define MG3TR_TARGET_SSE4 __attribute__((target("sse4.1")))
+        #define MG3TR_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+static void CheckSpanSize(const std::size_t expected_size, const std::size_t size)
+{
+    if (size != expected_size)
+    {
+        throw MG3TR::ExceptionWithStacktrace("Batch span has " + std::to_string(size)
+                                             + " elements instead of " + std::to_string(expected_size) + ".");
+    }
+}
+
+static const std::size_t k_frustum_plane_count = 6;
+static const std::size_t k_bits_per_visibility_word = 64;
+
+// Normal x, y, z and distance of every plane, in the order they are tested.
+using TFrustumPlanes = std::array<std::array<float, 4>, k_frustum_plane_count>;
+
+static TFrustumPlanes GetFrustumPlanes(const MG3TR::Frustum &frustum)
+{
+    const MG3TR::Plane planes[] = { frustum.GetLeftFace(), frustum.GetRightFace(), frustum.GetFarFace(),
+                                    frustum.GetNearFace(), frustum.GetTopFace(), frustum.GetBottomFace() };
+
+    TFrustumPlanes result{};
+    for (std::size_t i = 0; i < k_frustum_plane_count; ++i)
+    {
+        const MG3TR::Vector3 normal = planes[i].GetNormal();
+        result[i] = { normal.x(), normal.y(), normal.z(), planes[i].GetDistance() };
+    }
+
+    return result;
+}
+
+static void SetVisibilityBits(std::uint64_t *const visibility, const std::size_t first, const std::uint64_t bits)
+{
+    visibility[first / k_bits_per_visibility_word] |= bits << (first % k_bits_per_visibility_word);
+}
+
+static MG3TR::Math::BatchInstructionSet DetectInstructionSet()
+{
+    auto instruction_set = MG3TR::Math::BatchInstructionSet::Scalar;
+
+#if defined(MG3TR_BATCH_X86)
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int registers[4] = {};
+
+        __cpuid(registers, 0);
+        const int max_leaf = registers[0];
+
+        __cpuid(registers, 1);
+        const bool has_sse4 = (registers[2] & (1 << 19)) != 0;
+        // AVX registers are only usable if the OS saves them on context switches.
+        const bool has_os_avx = ((registers[2] & (1 << 27)) != 0) && ((registers[2] & (1 << 28)) != 0)
+                                && ((_xgetbv(0) & 0x6) == 0x6);
+
+        bool has_avx2 = false;
+        if (max_leaf >= 7)
+        {
+            __cpuidex(registers, 7, 0);
+            has_avx2 = has_os_avx && ((registers[1] & (1 << 5)) != 0);
+        }
+    #else
+        __builtin_cpu_init();
+        const bool has_sse4 = __builtin_cpu_supports("sse4.1") != 0;
+        const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+    #endif
+
+    if (has_avx2)
+    {
+        instruction_set = MG3TR::Math::BatchInstructionSet::AVX2;
+    }
+    else if (has_sse4)
+    {
+        instruction_set = MG3TR::Math::BatchInstructionSet::SSE4;
+    }
+#endif
+
+    return instruction_set;
+}
+
+// The kernels below process whole groups starting at begin and return the index of the first element they
+// did not process. The rest is left to the next narrower kernel.
+#if defined(MG3TR_BATCH_X86)
+// The signed distances are summed in the order of Plane::GetSignedDistance, so a sphere that touches a plane
+// is classified the same way on every path.
+MG3TR_TARGET_AVX2 static std::size_t CullSpheresAVX2(const TFrustumPlanes &planes, const float *const centers_x,
+                                                     const float *const centers_y, const float *const centers_z,
+                                                     const float *const radii, std::uint64_t *const visibility,
+                                                     const std::size_t begin, const std::size_t count)
+{
+    __m256 plane_components[k_frustum_plane_count][4];
+    for (std::size_t plane = 0; plane < k_frustum_plane_count; ++plane)
+    {
+        for (std::size_t component = 0; component < 4; ++component)
+        {
+            plane_components[plane][component] = _mm256_set1_ps(planes[plane][component]);
+        }
+    }
+
+    const __m256 sign_bit = _mm256_set1_ps(-0.0F);
+
+    std::size_t i = begin;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(centers_x + i);
+        const __m256 y = _mm256_loadu_ps(centers_y + i);
+        const __m256 z = _mm256_loadu_ps(centers_z + i);
+        const __m256 negated_radius = _mm256_xor_ps(_mm256_loadu_ps(radii + i), sign_bit);
+
+        __m256 is_visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (const auto &plane : plane_components)
+        {
+            const __m256 xy = _mm256_add_ps(_mm256_mul_ps(plane[0], x), _mm256_mul_ps(plane[1], y));
+            const __m256 dot = _mm256_add_ps(xy, _mm256_mul_ps(plane[2], z));
+            const __m256 signed_distance = _mm256_sub_ps(dot, plane[3]);
+
+            is_visible = _mm256_and_ps(is_visible, _mm256_cmp_ps(signed_distance, negated_radius, _CMP_GT_OQ));
+        }
+
+        SetVisibilityBits(visibility, i, static_cast<std::uint64_t>(_mm256_movemask_ps(is_visible)));
+    }
+
+    return i;
+}
+
+MG3TR_TARGET_SSE4 static std::size_t CullSpheresSSE4(const TFrustumPlanes &planes, const float *const centers_x,
+                                                     const float *const centers_y, const float *const centers_z,
+                                                     const float *const radii, std::uint64_t *const visibility,
+                                                     const std::size_t begin, const std::size_t count)
+{
+    __m128 plane_components[k_frustum_plane_count][4];
+    for (std::size_t plane = 0; plane < k_frustum_plane_count; ++plane)
+    {
+        for (std::size_t component = 0; component < 4; ++component)
+        {
+            plane_components[plane][component] = _mm_set1_ps(planes[plane][component]);
+        }
+    }
+
+    const __m128 sign_bit = _mm_set1_ps(-0.0F);
+
+    std::size_t i = begin;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(centers_x + i);
+        const __m128 y = _mm_loadu_ps(centers_y + i);
+        const __m128 z = _mm_loadu_ps(centers_z + i);
+        const __m128 negated_radius = _mm_xor_ps(_mm_loadu_ps(radii + i), sign_bit);
+
+        __m128 is_visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (const auto &plane : plane_components)
+        {
+            const __m128 xy = _mm_add_ps(_mm_mul_ps(plane[0], x), _mm_mul_ps(plane[1], y));
+            const __m128 dot = _mm_add_ps(xy, _mm_mul_ps(plane[2], z));
+            const __m128 signed_distance = _mm_sub_ps(dot, plane[3]);
+
+            is_visible = _mm_and_ps(is_visible, _mm_cmpgt_ps(signed_distance, negated_radius));
+        }
+
+        SetVisibilityBits(visibility, i, static_cast<std::uint64_t>(_mm_movemask_ps(is_visible)));
+    }
+
+    return i;
+}
+#endif
+
+namespace MG3TR::Math
+{
+    BatchInstructionSet GetBatchInstructionSet()
+    {
+        static const BatchInstructionSet instruction_set = DetectInstructionSet();
+        return instruction_set;
+    }
+
+    std::size_t GetVisibilityWordCount(const std::size_t sphere_count)
+    {
+        const std::size_t word_count = (sphere_count + k_bits_per_visibility_word - 1) / k_bits_per_visibility_word;
+        return word_count;
+    }
+
+    void CullSpheres(const Frustum &frustum, std::span<const float> centers_x, std::span<const float> centers_y,
+                     std::span<const float> centers_z, std::span<const float> radii,
+                     std::span<std::uint64_t> visibility)
+    {
+        CullSpheres(frustum, centers_x, centers_y, centers_z, radii, visibility, GetBatchInstructionSet());
+    }
+
+    void CullSpheres(const Frustum &frustum, std::span<const float> centers_x, std::span<const float> centers_y,
+                     std::span<const float> centers_z, std::span<const float> radii,
+                     std::span<std::uint64_t> visibility, const BatchInstructionSet instruction_set)
+    {
+        if (instruction_set > GetBatchInstructionSet())
+        {
+            throw ExceptionWithStacktrace("The processor does not support the requested batch instruction set.");
+        }
+
+        const std::size_t count = centers_x.size();
+
+        CheckSpanSize(count, centers_y.size());
+        CheckSpanSize(count, centers_z.size());
+        CheckSpanSize(count, radii.size());
+        CheckSpanSize(GetVisibilityWordCount(count), visibility.size());
+
+        std::fill(visibility.begin(), visibility.end(), std::uint64_t{0});
+
+        const TFrustumPlanes planes = GetFrustumPlanes(frustum);
+
+        std::size_t first = 0;
+
+#if defined(MG3TR_BATCH_X86)
+        // Both kernels start on a multiple of their width, so no group straddles two words.
+        if ((count > 0) && (instruction_set == BatchInstructionSet::AVX2))
+        {
+            first = CullSpheresAVX2(planes, centers_x.data(), centers_y.data(), centers_z.data(), radii.data(),
+                                    visibility.data(), first, count);
+        }
+
+        if ((count > 0) && (instruction_set != BatchInstructionSet::Scalar))
+        {
+            first = CullSpheresSSE4(planes, centers_x.data(), centers_y.data(), centers_z.data(), radii.data(),
+                                    visibility.data(), first, count);
+        }
+#endif
+
+        for (std::size_t i = first; i < count; ++i)
+        {
+            bool is_visible = true;
+
+            for (const auto &plane : planes)
+            {
+                const float dot = ((plane[0] * centers_x[i]) + (plane[1] * centers_y[i])) + (plane[2] * centers_z[i]);
+                const float signed_distance = dot - plane[3];
+
+                is_visible = is_visible && (signed_distance > -radii[i]);
+            }
+
+            SetVisibilityBits(visibility.data(), i, is_visible ? 1U : 0U);
+        }
+    }
+}
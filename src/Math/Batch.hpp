@@ -0,0 +1,42 @@
+#ifndef MG3TR_SRC_MATH_BATCH_HPP_INCLUDED
+#define MG3TR_SRC_MATH_BATCH_HPP_INCLUDED
+
+#include <Math/Frustum.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Operations over arrays of math values. The implementation is picked once at runtime from AVX2,
+// SSE4.1 and a scalar fallback. Every path uses the same operation order as the per-element
+// operators, so the results match them exactly.
+namespace MG3TR::Math
+{
+    // Ordered from the narrowest to the widest, each one also allowing the ones before it.
+    enum class BatchInstructionSet
+    {
+        Scalar,
+        SSE4,
+        AVX2
+    };
+
+    // The widest instruction set the processor supports.
+    BatchInstructionSet GetBatchInstructionSet();
+
+    // Number of 64 bit words holding one bit per sphere.
+    std::size_t GetVisibilityWordCount(const std::size_t sphere_count);
+
+    // Sets bit (i % 64) of visibility[i / 64] when sphere i is on or in front of all six planes, as
+    // Sphere::IsOnOrInFrontOfPlane decides it, and clears it otherwise. The spheres are given as one array
+    // per field, and visibility must have GetVisibilityWordCount(sphere count) words.
+    void CullSpheres(const Frustum &frustum, std::span<const float> centers_x, std::span<const float> centers_y,
+                     std::span<const float> centers_z, std::span<const float> radii,
+                     std::span<std::uint64_t> visibility);
+    // Uses the given instruction set instead, so that every path can be checked against the others.
+    // Throws if the processor does not support it.
+    void CullSpheres(const Frustum &frustum, std::span<const float> centers_x, std::span<const float> centers_y,
+                     std::span<const float> centers_z, std::span<const float> radii,
+                     std::span<std::uint64_t> visibility, const BatchInstructionSet instruction_set);
+}
+
+#endif // MG3TR_SRC_MATH_BATCH_HPP_INCLUDED
@@ -0,0 +1,120 @@
+#include "BoundingBox.hpp"
+
+#include <Math/Math.hxx>
+
+#include <limits>
+
+namespace MG3TR
+{
+    BoundingBox::BoundingBox()
+        : m_min(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+                std::numeric_limits<float>::infinity()),
+          m_max(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                -std::numeric_limits<float>::infinity())
+    {
+
+    }
+
+    BoundingBox::BoundingBox(const Vector3 &min, const Vector3 &max)
+        : m_min(min),
+          m_max(max)
+    {
+
+    }
+
+    BoundingBox::BoundingBox(const Sphere &sphere)
+        : m_min(sphere.GetCenter() - sphere.GetRadius()),
+          m_max(sphere.GetCenter() + sphere.GetRadius())
+    {
+
+    }
+
+    Vector3 BoundingBox::GetMin() const
+    {
+        return m_min;
+    }
+
+    Vector3 BoundingBox::GetMax() const
+    {
+        return m_max;
+    }
+
+    Vector3 BoundingBox::GetCenter() const
+    {
+        const Vector3 center = (m_min + m_max) * 0.5F;
+        return center;
+    }
+
+    Vector3 BoundingBox::GetExtents() const
+    {
+        const Vector3 extents = (m_max - m_min) * 0.5F;
+        return extents;
+    }
+
+    bool BoundingBox::IsEmpty() const
+    {
+        const bool is_empty = (m_min.x() > m_max.x()) || (m_min.y() > m_max.y()) || (m_min.z() > m_max.z());
+        return is_empty;
+    }
+
+    float BoundingBox::GetSurfaceArea() const
+    {
+        if (IsEmpty())
+        {
+            return 0.0F;
+        }
+
+        const Vector3 size = m_max - m_min;
+        const float area = 2.0F * ((size.x() * size.y()) + (size.y() * size.z()) + (size.z() * size.x()));
+
+        return area;
+    }
+
+    void BoundingBox::Encapsulate(const Vector3 &point)
+    {
+        m_min = Vector3::Min(m_min, point);
+        m_max = Vector3::Max(m_max, point);
+    }
+
+    void BoundingBox::Encapsulate(const BoundingBox &box)
+    {
+        m_min = Vector3::Min(m_min, box.m_min);
+        m_max = Vector3::Max(m_max, box.m_max);
+    }
+
+    PlaneSide BoundingBox::GetPlaneSide(const Plane &plane) const
+    {
+        const Vector3 normal = plane.GetNormal();
+        const Vector3 extents = GetExtents();
+
+        // Distance from the center to the corner furthest along the normal.
+        const float projected_extent = (Math::Abs(normal.x()) * extents.x()) + (Math::Abs(normal.y()) * extents.y())
+                                       + (Math::Abs(normal.z()) * extents.z());
+        const float signed_distance = plane.GetSignedDistance(GetCenter());
+
+        PlaneSide side = PlaneSide::Intersecting;
+
+        if (signed_distance < -projected_extent)
+        {
+            side = PlaneSide::Behind;
+        }
+        else if (signed_distance > projected_extent)
+        {
+            side = PlaneSide::InFront;
+        }
+
+        return side;
+    }
+
+    BoundingBox BoundingBox::Enclosing(std::span<const Vector3> points)
+    {
+        BoundingBox box;
+
+        for (const auto &point : points)
+        {
+            box.Encapsulate(point);
+        }
+
+        return box;
+    }
+}
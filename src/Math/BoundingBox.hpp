@@ -0,0 +1,59 @@
+#ifndef MG3TR_SRC_MATH_BOUNDINGBOX_HPP_INCLUDED
+#define MG3TR_SRC_MATH_BOUNDINGBOX_HPP_INCLUDED
+
+#include <Math/Plane.hpp>
+#include <Math/Sphere.hpp>
+#include <Math/Vector3.hpp>
+
+#include <span>
+
+namespace MG3TR
+{
+    enum class PlaneSide : unsigned char
+    {
+        Behind = 0U,
+        Intersecting = 1U,
+        InFront = 2U
+    };
+
+    // Axis aligned box. A default constructed box is empty and is replaced by the first volume it encapsulates.
+    class BoundingBox
+    {
+    private:
+        Vector3 m_min;
+        Vector3 m_max;
+
+    public:
+        BoundingBox();
+        BoundingBox(const Vector3 &min, const Vector3 &max);
+        explicit BoundingBox(const Sphere &sphere);
+        ~BoundingBox() = default;
+
+        BoundingBox(const BoundingBox &) = default;
+        BoundingBox(BoundingBox &&) = default;
+
+        BoundingBox& operator=(const BoundingBox &) = default;
+        BoundingBox& operator=(BoundingBox &&) = default;
+
+        Vector3 GetMin() const;
+        Vector3 GetMax() const;
+        Vector3 GetCenter() const;
+        // Half of the size along each axis.
+        Vector3 GetExtents() const;
+
+        bool IsEmpty() const;
+        // 0 for an empty box.
+        float GetSurfaceArea() const;
+
+        void Encapsulate(const Vector3 &point);
+        void Encapsulate(const BoundingBox &box);
+
+        // Empty when there are no points.
+        static BoundingBox Enclosing(std::span<const Vector3> points);
+
+        // Whether the whole box is strictly behind or in front of the plane, or crosses it.
+        PlaneSide GetPlaneSide(const Plane &plane) const;
+    };
+}
+
+#endif // MG3TR_SRC_MATH_BOUNDINGBOX_HPP_INCLUDED
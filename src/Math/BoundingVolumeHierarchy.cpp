@@ -0,0 +1,559 @@
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <Math/Batch.hpp>
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string>
+
+static const std::uint32_t k_no_node = std::numeric_limits<std::uint32_t>::max();
+static const std::uint32_t k_max_leaf_size = 8U;
+static const std::uint32_t k_bin_count = 16U;
+// Cost of visiting a node, relative to testing one sphere. Spheres are tested in batches by
+// Math::CullSpheres, which makes them cheap next to a box.
+static const float k_traversal_cost = 4.0F;
+static const float k_default_rebuild_cost_ratio = 1.5F;
+
+static const std::size_t k_frustum_plane_count = 6;
+static const std::uint8_t k_all_planes_mask = (1U << k_frustum_plane_count) - 1U;
+
+static std::size_t GetLargestAxis(const MG3TR::Vector3 &size)
+{
+    std::size_t axis = 0;
+
+    if (size.y() > size[axis])
+    {
+        axis = 1;
+    }
+
+    if (size.z() > size[axis])
+    {
+        axis = 2;
+    }
+
+    return axis;
+}
+
+namespace MG3TR
+{
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+        : m_nodes(),
+          m_is_node_dirty(),
+          m_leaf_proxies(),
+          m_spheres(),
+          m_leaf_of_proxy(),
+          m_is_proxy_alive(),
+          m_free_proxies(),
+          m_is_rebuild_needed(false),
+          m_is_refit_needed(false),
+          m_built_cost(0.0F),
+          m_rebuild_cost_ratio(k_default_rebuild_cost_ratio),
+          m_statistics{}
+    {
+
+    }
+
+    TBVHProxy BoundingVolumeHierarchy::Insert(const Sphere &sphere)
+    {
+        TBVHProxy proxy = k_invalid_bvh_proxy;
+
+        if (!m_free_proxies.empty())
+        {
+            proxy = m_free_proxies.back();
+            m_free_proxies.pop_back();
+
+            m_spheres[proxy] = sphere;
+            m_leaf_of_proxy[proxy] = k_no_node;
+            m_is_proxy_alive[proxy] = 1U;
+        }
+        else
+        {
+            proxy = static_cast<TBVHProxy>(m_spheres.size());
+
+            m_spheres.push_back(sphere);
+            m_leaf_of_proxy.push_back(k_no_node);
+            m_is_proxy_alive.push_back(1U);
+        }
+
+        m_is_rebuild_needed = true;
+
+        return proxy;
+    }
+
+    void BoundingVolumeHierarchy::Remove(const TBVHProxy proxy)
+    {
+        if ((proxy >= m_is_proxy_alive.size()) || (m_is_proxy_alive[proxy] == 0U))
+        {
+            throw ExceptionWithStacktrace("BVH proxy " + std::to_string(proxy) + " does not exist.");
+        }
+
+        m_is_proxy_alive[proxy] = 0U;
+        m_leaf_of_proxy[proxy] = k_no_node;
+        m_free_proxies.push_back(proxy);
+
+        m_is_rebuild_needed = true;
+    }
+
+    void BoundingVolumeHierarchy::Move(const TBVHProxy proxy, const Sphere &sphere)
+    {
+        m_spheres[proxy] = sphere;
+
+        const std::uint32_t leaf = m_leaf_of_proxy[proxy];
+        if (leaf != k_no_node)
+        {
+            MarkLeafDirty(leaf);
+            m_is_refit_needed = true;
+        }
+    }
+
+    Sphere BoundingVolumeHierarchy::GetSphere(const TBVHProxy proxy) const
+    {
+        return m_spheres[proxy];
+    }
+
+    std::size_t BoundingVolumeHierarchy::GetProxyCount() const
+    {
+        const std::size_t count = m_spheres.size() - m_free_proxies.size();
+        return count;
+    }
+
+    std::size_t BoundingVolumeHierarchy::GetNodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    void BoundingVolumeHierarchy::SetRebuildCostRatio(const float ratio)
+    {
+        m_rebuild_cost_ratio = ratio;
+    }
+
+    float BoundingVolumeHierarchy::GetRebuildCostRatio() const
+    {
+        return m_rebuild_cost_ratio;
+    }
+
+    void BoundingVolumeHierarchy::Update()
+    {
+        if (m_is_rebuild_needed)
+        {
+            Rebuild();
+        }
+        else if (m_is_refit_needed)
+        {
+            Refit();
+
+            if (CalculateCost() > (m_built_cost * m_rebuild_cost_ratio))
+            {
+                Rebuild();
+            }
+        }
+    }
+
+    void BoundingVolumeHierarchy::CullFrustum(const Frustum &frustum, std::vector<TBVHProxy> &visible_proxies)
+    {
+        m_statistics = {};
+
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
+        const std::array<Plane, k_frustum_plane_count> planes = { frustum.GetLeftFace(), frustum.GetRightFace(),
+                                                                  frustum.GetFarFace(), frustum.GetNearFace(),
+                                                                  frustum.GetTopFace(), frustum.GetBottomFace() };
+
+        m_candidates.clear();
+        m_candidate_centers_x.clear();
+        m_candidate_centers_y.clear();
+        m_candidate_centers_z.clear();
+        m_candidate_radii.clear();
+
+        m_node_stack.clear();
+        m_plane_mask_stack.clear();
+        m_node_stack.push_back(0U);
+        m_plane_mask_stack.push_back(k_all_planes_mask);
+
+        while (!m_node_stack.empty())
+        {
+            const std::uint32_t node_index = m_node_stack.back();
+            std::uint8_t plane_mask = m_plane_mask_stack.back();
+            m_node_stack.pop_back();
+            m_plane_mask_stack.pop_back();
+
+            ++m_statistics.m_nodes_visited;
+
+            const Node &node = m_nodes[node_index];
+            bool is_outside = false;
+
+            // Planes the node is fully in front of are skipped for the whole subtree.
+            for (std::size_t i = 0; (i < k_frustum_plane_count) && !is_outside; ++i)
+            {
+                if ((plane_mask & (1U << i)) == 0U)
+                {
+                    continue;
+                }
+
+                const PlaneSide side = node.m_bounds.GetPlaneSide(planes[i]);
+
+                if (side == PlaneSide::Behind)
+                {
+                    is_outside = true;
+                }
+                else if (side == PlaneSide::InFront)
+                {
+                    plane_mask = static_cast<std::uint8_t>(plane_mask & ~(1U << i));
+                }
+            }
+
+            if (is_outside)
+            {
+                continue;
+            }
+
+            if (plane_mask == 0U)
+            {
+                AcceptSubtree(node_index, visible_proxies);
+            }
+            else if (node.m_second_child == 0U)
+            {
+                AddCandidates(node_index);
+            }
+            else
+            {
+                m_node_stack.push_back(node.m_second_child);
+                m_plane_mask_stack.push_back(plane_mask);
+                m_node_stack.push_back(node_index + 1U);
+                m_plane_mask_stack.push_back(plane_mask);
+            }
+        }
+
+        m_candidate_visibility.resize(Math::GetVisibilityWordCount(m_candidates.size()));
+        Math::CullSpheres(frustum, m_candidate_centers_x, m_candidate_centers_y, m_candidate_centers_z,
+                          m_candidate_radii, m_candidate_visibility);
+
+        for (std::size_t word_index = 0; word_index < m_candidate_visibility.size(); ++word_index)
+        {
+            std::uint64_t word = m_candidate_visibility[word_index];
+
+            while (word != 0U)
+            {
+                const auto bit = static_cast<std::size_t>(std::countr_zero(word));
+                word &= word - 1U;
+
+                visible_proxies.push_back(m_candidates[(word_index * 64U) + bit]);
+                ++m_statistics.m_objects_visible;
+            }
+        }
+
+        m_statistics.m_objects_tested = m_candidates.size();
+    }
+
+    const BVHCullStatistics& BoundingVolumeHierarchy::GetLastCullStatistics() const
+    {
+        return m_statistics;
+    }
+
+    void BoundingVolumeHierarchy::Rebuild()
+    {
+        m_nodes.clear();
+        m_leaf_proxies.clear();
+
+        m_build_boxes.resize(m_spheres.size());
+        m_build_centers.resize(m_spheres.size());
+
+        for (TBVHProxy proxy = 0; proxy < m_spheres.size(); ++proxy)
+        {
+            if (m_is_proxy_alive[proxy] != 0U)
+            {
+                m_leaf_proxies.push_back(proxy);
+                m_build_boxes[proxy] = BoundingBox(m_spheres[proxy]);
+                m_build_centers[proxy] = m_spheres[proxy].GetCenter();
+            }
+        }
+
+        if (!m_leaf_proxies.empty())
+        {
+            (void)BuildNode(0U, static_cast<std::uint32_t>(m_leaf_proxies.size()), k_no_node);
+        }
+
+        m_is_node_dirty.assign(m_nodes.size(), 0U);
+        m_built_cost = CalculateCost();
+        m_is_rebuild_needed = false;
+        m_is_refit_needed = false;
+    }
+
+    // Builds depth first with an explicit stack, so that an unbalanced split cannot overflow the call stack.
+    std::uint32_t BoundingVolumeHierarchy::BuildNode(const std::uint32_t first, const std::uint32_t count,
+                                                     const std::uint32_t parent)
+    {
+        struct PendingNode
+        {
+            std::uint32_t m_first;
+            std::uint32_t m_count;
+            std::uint32_t m_parent;
+            bool m_is_second_child;
+        };
+
+        const auto root = static_cast<std::uint32_t>(m_nodes.size());
+        std::vector<PendingNode> pending_nodes = { { first, count, parent, false } };
+
+        while (!pending_nodes.empty())
+        {
+            const PendingNode pending = pending_nodes.back();
+            pending_nodes.pop_back();
+
+            const auto node_index = static_cast<std::uint32_t>(m_nodes.size());
+
+            BoundingBox bounds;
+            for (std::uint32_t i = pending.m_first; i < pending.m_first + pending.m_count; ++i)
+            {
+                const TBVHProxy proxy = m_leaf_proxies[i];
+
+                bounds.Encapsulate(m_build_boxes[proxy]);
+                m_leaf_of_proxy[proxy] = node_index;
+            }
+
+            m_nodes.push_back({ bounds, pending.m_parent, 0U, pending.m_first, pending.m_count });
+
+            if (pending.m_is_second_child)
+            {
+                m_nodes[pending.m_parent].m_second_child = node_index;
+            }
+
+            const std::uint32_t left_count = PartitionNode(pending.m_first, pending.m_count, bounds);
+            if (left_count > 0U)
+            {
+                // The first child is popped next, so that it directly follows its parent.
+                pending_nodes.push_back({ pending.m_first + left_count, pending.m_count - left_count, node_index, true });
+                pending_nodes.push_back({ pending.m_first, left_count, node_index, false });
+            }
+        }
+
+        return root;
+    }
+
+    // Returns how many proxies go to the first child, or 0 if the node should be a leaf.
+    std::uint32_t BoundingVolumeHierarchy::PartitionNode(const std::uint32_t first, const std::uint32_t count,
+                                                         const BoundingBox &bounds)
+    {
+        if (count <= 1U)
+        {
+            return 0U;
+        }
+
+        const auto range_begin = m_leaf_proxies.begin() + first;
+        const auto range_end = range_begin + count;
+
+        BoundingBox center_bounds;
+        for (auto it = range_begin; it != range_end; ++it)
+        {
+            center_bounds.Encapsulate(m_build_centers[*it]);
+        }
+
+        const Vector3 center_size = center_bounds.GetMax() - center_bounds.GetMin();
+        const std::size_t axis = GetLargestAxis(center_size);
+        const float axis_min = center_bounds.GetMin()[axis];
+        const float axis_size = center_size[axis];
+
+        const auto split_in_half = [this, range_begin, range_end, count, axis]()
+        {
+            const auto middle = range_begin + (count / 2U);
+            std::nth_element(range_begin, middle, range_end,
+                             [this, axis](const TBVHProxy lhs, const TBVHProxy rhs)
+                             {
+                                 return m_build_centers[lhs][axis] < m_build_centers[rhs][axis];
+                             });
+            return count / 2U;
+        };
+
+        // Every center is at the same place, so the heuristic cannot tell the proxies apart.
+        if (axis_size <= 0.0F)
+        {
+            const std::uint32_t left_count = (count > k_max_leaf_size) ? split_in_half() : 0U;
+            return left_count;
+        }
+
+        const float bin_scale = static_cast<float>(k_bin_count) / axis_size;
+        const auto get_bin = [this, axis, axis_min, bin_scale](const TBVHProxy proxy)
+        {
+            const auto bin = static_cast<std::uint32_t>((m_build_centers[proxy][axis] - axis_min) * bin_scale);
+            return std::min(bin, k_bin_count - 1U);
+        };
+
+        std::array<BoundingBox, k_bin_count> bin_bounds{};
+        std::array<std::uint32_t, k_bin_count> bin_counts{};
+
+        for (auto it = range_begin; it != range_end; ++it)
+        {
+            const std::uint32_t bin = get_bin(*it);
+
+            bin_bounds[bin].Encapsulate(m_build_boxes[*it]);
+            ++bin_counts[bin];
+        }
+
+        // Areas and counts of the bins from i to the last one.
+        std::array<float, k_bin_count> right_areas{};
+        std::array<std::uint32_t, k_bin_count> right_counts{};
+        BoundingBox right_bounds;
+        std::uint32_t right_count = 0U;
+
+        for (std::uint32_t i = k_bin_count; i-- > 0U;)
+        {
+            right_bounds.Encapsulate(bin_bounds[i]);
+            right_count += bin_counts[i];
+
+            right_areas[i] = right_bounds.GetSurfaceArea();
+            right_counts[i] = right_count;
+        }
+
+        // Costs are left multiplied by the area of the node, which does not change their order.
+        float best_cost = std::numeric_limits<float>::infinity();
+        std::uint32_t best_split_bin = 0U;
+        BoundingBox left_bounds;
+        std::uint32_t left_count = 0U;
+
+        for (std::uint32_t split_bin = 1U; split_bin < k_bin_count; ++split_bin)
+        {
+            left_bounds.Encapsulate(bin_bounds[split_bin - 1U]);
+            left_count += bin_counts[split_bin - 1U];
+
+            if ((left_count == 0U) || (right_counts[split_bin] == 0U))
+            {
+                continue;
+            }
+
+            const float cost = (left_bounds.GetSurfaceArea() * static_cast<float>(left_count))
+                               + (right_areas[split_bin] * static_cast<float>(right_counts[split_bin]));
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_split_bin = split_bin;
+            }
+        }
+
+        const float node_area = bounds.GetSurfaceArea();
+        const float leaf_cost = node_area * static_cast<float>(count);
+        const float split_cost = (node_area * k_traversal_cost) + best_cost;
+
+        if ((count <= k_max_leaf_size) && (leaf_cost <= split_cost))
+        {
+            return 0U;
+        }
+
+        if (best_split_bin == 0U)
+        {
+            return split_in_half();
+        }
+
+        const auto middle = std::partition(range_begin, range_end,
+                                           [&get_bin, best_split_bin](const TBVHProxy proxy)
+                                           {
+                                               return get_bin(proxy) < best_split_bin;
+                                           });
+        const auto partition_count = static_cast<std::uint32_t>(middle - range_begin);
+
+        return partition_count;
+    }
+
+    // Children are stored after their parent, so a backwards pass sees them first.
+    void BoundingVolumeHierarchy::Refit()
+    {
+        for (std::size_t i = m_nodes.size(); i-- > 0;)
+        {
+            if (m_is_node_dirty[i] == 0U)
+            {
+                continue;
+            }
+
+            Node &node = m_nodes[i];
+            BoundingBox bounds;
+
+            if (node.m_second_child == 0U)
+            {
+                for (std::uint32_t j = node.m_first_proxy; j < node.m_first_proxy + node.m_proxy_count; ++j)
+                {
+                    bounds.Encapsulate(BoundingBox(m_spheres[m_leaf_proxies[j]]));
+                }
+            }
+            else
+            {
+                bounds.Encapsulate(m_nodes[i + 1].m_bounds);
+                bounds.Encapsulate(m_nodes[node.m_second_child].m_bounds);
+            }
+
+            node.m_bounds = bounds;
+            m_is_node_dirty[i] = 0U;
+        }
+
+        m_is_refit_needed = false;
+    }
+
+    void BoundingVolumeHierarchy::MarkLeafDirty(const std::uint32_t leaf)
+    {
+        std::uint32_t node = leaf;
+
+        // A dirty node already has dirty ancestors.
+        while ((node != k_no_node) && (m_is_node_dirty[node] == 0U))
+        {
+            m_is_node_dirty[node] = 1U;
+            node = m_nodes[node].m_parent;
+        }
+    }
+
+    // Expected cost of a query that reaches every node, relative to testing one sphere, assuming a node is
+    // reached with a probability proportional to its area.
+    float BoundingVolumeHierarchy::CalculateCost() const
+    {
+        if (m_nodes.empty())
+        {
+            return 0.0F;
+        }
+
+        float cost = 0.0F;
+
+        for (const auto &node : m_nodes)
+        {
+            const float per_area_cost = (node.m_second_child == 0U) ? static_cast<float>(node.m_proxy_count)
+                                                                     : k_traversal_cost;
+            cost += node.m_bounds.GetSurfaceArea() * per_area_cost;
+        }
+
+        const float root_area = m_nodes.front().m_bounds.GetSurfaceArea();
+        if (root_area > 0.0F)
+        {
+            cost /= root_area;
+        }
+
+        return cost;
+    }
+
+    void BoundingVolumeHierarchy::AcceptSubtree(const std::uint32_t node, std::vector<TBVHProxy> &visible_proxies)
+    {
+        const auto first = m_leaf_proxies.cbegin() + m_nodes[node].m_first_proxy;
+        const auto last = first + m_nodes[node].m_proxy_count;
+
+        (void)visible_proxies.insert(visible_proxies.end(), first, last);
+        m_statistics.m_objects_visible += m_nodes[node].m_proxy_count;
+    }
+
+    void BoundingVolumeHierarchy::AddCandidates(const std::uint32_t node)
+    {
+        const std::uint32_t first = m_nodes[node].m_first_proxy;
+        const std::uint32_t last = first + m_nodes[node].m_proxy_count;
+
+        for (std::uint32_t i = first; i < last; ++i)
+        {
+            const TBVHProxy proxy = m_leaf_proxies[i];
+            const Sphere &sphere = m_spheres[proxy];
+            const Vector3 center = sphere.GetCenter();
+
+            m_candidates.push_back(proxy);
+            m_candidate_centers_x.push_back(center.x());
+            m_candidate_centers_y.push_back(center.y());
+            m_candidate_centers_z.push_back(center.z());
+            m_candidate_radii.push_back(sphere.GetRadius());
+        }
+    }
+}
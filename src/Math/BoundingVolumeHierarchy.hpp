@@ -0,0 +1,122 @@
+#ifndef MG3TR_SRC_MATH_BOUNDINGVOLUMEHIERARCHY_HPP_INCLUDED
+#define MG3TR_SRC_MATH_BOUNDINGVOLUMEHIERARCHY_HPP_INCLUDED
+
+#include <Math/BoundingBox.hpp>
+#include <Math/Frustum.hpp>
+#include <Math/Sphere.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace MG3TR
+{
+    using TBVHProxy = std::uint32_t;
+
+    const TBVHProxy k_invalid_bvh_proxy = std::numeric_limits<TBVHProxy>::max();
+
+    struct BVHCullStatistics
+    {
+        std::size_t m_nodes_visited;
+        // Spheres tested one by one, in leaves that cross the frustum.
+        std::size_t m_objects_tested;
+        std::size_t m_objects_visible;
+    };
+
+    // Binary tree of boxes over a set of spheres, used to reject whole groups of them at once.
+    //
+    // Moving a sphere only refits the boxes above it, which keeps the tree correct but makes it looser.
+    // The tree is rebuilt with a binned surface area heuristic when spheres are added or removed, or
+    // when the estimated cost of a query has grown too much since the last build.
+    //
+    // Nodes are stored depth first, so the first child of a node directly follows it and the spheres
+    // of a subtree are contiguous in the leaf order.
+    class BoundingVolumeHierarchy
+    {
+    private:
+        struct Node
+        {
+            BoundingBox m_bounds;
+            std::uint32_t m_parent;
+            // 0 for leaves, since the root is never a second child.
+            std::uint32_t m_second_child;
+            std::uint32_t m_first_proxy;
+            std::uint32_t m_proxy_count;
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<std::uint8_t> m_is_node_dirty;
+        // Proxies in leaf order.
+        std::vector<TBVHProxy> m_leaf_proxies;
+
+        // Indexed by proxy.
+        std::vector<Sphere> m_spheres;
+        std::vector<std::uint32_t> m_leaf_of_proxy;
+        std::vector<std::uint8_t> m_is_proxy_alive;
+        std::vector<TBVHProxy> m_free_proxies;
+
+        bool m_is_rebuild_needed;
+        bool m_is_refit_needed;
+        float m_built_cost;
+        float m_rebuild_cost_ratio;
+
+        BVHCullStatistics m_statistics;
+
+        std::vector<BoundingBox> m_build_boxes;
+        std::vector<Vector3> m_build_centers;
+        std::vector<std::uint32_t> m_node_stack;
+        std::vector<std::uint8_t> m_plane_mask_stack;
+        std::vector<TBVHProxy> m_candidates;
+        std::vector<float> m_candidate_centers_x;
+        std::vector<float> m_candidate_centers_y;
+        std::vector<float> m_candidate_centers_z;
+        std::vector<float> m_candidate_radii;
+        std::vector<std::uint64_t> m_candidate_visibility;
+
+    public:
+        BoundingVolumeHierarchy();
+        ~BoundingVolumeHierarchy() = default;
+
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy &) = default;
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy &&) = default;
+
+        BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy &) = default;
+        BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy &&) = default;
+
+        TBVHProxy Insert(const Sphere &sphere);
+        void Remove(const TBVHProxy proxy);
+        void Move(const TBVHProxy proxy, const Sphere &sphere);
+
+        Sphere GetSphere(const TBVHProxy proxy) const;
+        std::size_t GetProxyCount() const;
+        std::size_t GetNodeCount() const;
+
+        // The tree is rebuilt once refitting makes a query this many times more expensive than right after
+        // the last build.
+        void SetRebuildCostRatio(const float ratio);
+        float GetRebuildCostRatio() const;
+
+        // Applies the changes made since the last call. Must be called before culling.
+        void Update();
+
+        // Appends the proxies of the spheres that Sphere::IsOnOrInFrontOfPlane finds on or in front of every
+        // plane of the frustum. Spheres in nodes fully inside the frustum are accepted without being tested.
+        void CullFrustum(const Frustum &frustum, std::vector<TBVHProxy> &visible_proxies);
+        const BVHCullStatistics& GetLastCullStatistics() const;
+
+    private:
+        void Rebuild();
+        std::uint32_t BuildNode(const std::uint32_t first, const std::uint32_t count, const std::uint32_t parent);
+        std::uint32_t PartitionNode(const std::uint32_t first, const std::uint32_t count, const BoundingBox &bounds);
+
+        void Refit();
+        void MarkLeafDirty(const std::uint32_t leaf);
+        float CalculateCost() const;
+
+        void AcceptSubtree(const std::uint32_t node, std::vector<TBVHProxy> &visible_proxies);
+        void AddCandidates(const std::uint32_t node);
+    };
+}
+
+#endif // MG3TR_SRC_MATH_BOUNDINGVOLUMEHIERARCHY_HPP_INCLUDED
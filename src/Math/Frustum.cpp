@@ -1,48 +1,33 @@
 #include "Frustum.hpp"
 
-#include <Components/Camera.hpp>
-#include <Math/Math.hxx>
-#include <Math/Vector3.hpp>
-#include <Scripting/Transform.hpp>
+#include <cstddef>
 
-namespace MG3TR
+// Gribb-Hartmann: a clip space point is inside a face when w + sign * (its coordinate) >= 0, which
+// in world space is the plane given by the last row of the view-projection plus sign times another row.
+static MG3TR::Plane ExtractPlane(const MG3TR::Matrix4x4 &view_projection, const std::size_t row, const float sign)
 {
-    Frustum::Frustum(const Camera &camera) 
-    {
-        const auto camera_transform = camera.GetTransform().lock();
-        const Vector3 camera_position = camera_transform->GetWorldPosition();
-
-        const float half_vertical_side = camera.GetZfar() * Math::Tan(camera.GetFov() * 0.5F);
-        const float half_horizontal_side = half_vertical_side * camera.GetAspectRatio();
-        const Vector3 front_times_far = camera.GetZfar() * camera_transform->GetForwards();
-    
-        const Vector3 mear_face_normal = camera_transform->GetForwards();
-        const Vector3 near_face_center = camera_position + camera.GetZnear() * camera_transform->GetForwards();
-        m_near_face = Plane(mear_face_normal, near_face_center);
-
-        const Vector3 far_face_normal = -camera_transform->GetForwards();
-        const Vector3 far_face_center = camera_position + camera.GetZfar() * camera_transform->GetForwards();
-        m_far_face = Plane(far_face_normal, far_face_center);
+    const MG3TR::Vector3 normal(view_projection[3, 0] + (sign * view_projection[row, 0]),
+                                view_projection[3, 1] + (sign * view_projection[row, 1]),
+                                view_projection[3, 2] + (sign * view_projection[row, 2]));
+    const float offset = view_projection[3, 3] + (sign * view_projection[row, 3]);
 
-        const Vector3 right_face_normal = Vector3::Cross(camera_transform->GetUp().Normalize(),
-                                                         (front_times_far + camera_transform->GetRight() * half_horizontal_side).Normalize());
-        const Vector3 right_face_position = camera_position;
-        m_right_face = Plane(right_face_normal, right_face_position);
+    const float inverse_length = 1.0F / normal.Magnitude();
+    const MG3TR::Plane plane(normal * inverse_length, -offset * inverse_length);
 
-        const Vector3 left_face_normal = Vector3::Cross((front_times_far - camera_transform->GetRight() * half_horizontal_side).Normalize(),
-                                                         camera_transform->GetUp().Normalize());
-        const Vector3 left_face_position = camera_position;
-        m_left_face = Plane(left_face_normal, left_face_position);
+    return plane;
+}
 
-        const Vector3 top_face_normal = Vector3::Cross((front_times_far + camera_transform->GetUp() * half_vertical_side).Normalize(),
-                                                        camera_transform->GetRight().Normalize());
-        const Vector3 top_face_position = camera_position;
-        m_top_face = Plane(top_face_normal, top_face_position);
+namespace MG3TR
+{
+    Frustum::Frustum(const Matrix4x4 &view_projection)
+        : m_top_face(ExtractPlane(view_projection, 1, -1.0F)),
+          m_bottom_face(ExtractPlane(view_projection, 1, 1.0F)),
+          m_right_face(ExtractPlane(view_projection, 0, -1.0F)),
+          m_left_face(ExtractPlane(view_projection, 0, 1.0F)),
+          m_far_face(ExtractPlane(view_projection, 2, -1.0F)),
+          m_near_face(ExtractPlane(view_projection, 2, 1.0F))
+    {
 
-        const Vector3 bottom_face_normal = Vector3::Cross(camera_transform->GetRight().Normalize(),
-                                                          (front_times_far - camera_transform->GetUp() * half_vertical_side).Normalize());
-        const Vector3 bottom_face_position = camera_position;
-        m_bottom_face = Plane(bottom_face_normal, bottom_face_position);
     }
 
     Plane Frustum::GetTopFace() const
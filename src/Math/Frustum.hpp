@@ -1,12 +1,12 @@
 #ifndef MG3TR_SRC_MATH_FRUSTUM_HPP_INCLUDED
 #define MG3TR_SRC_MATH_FRUSTUM_HPP_INCLUDED
 
+#include <Math/Matrix4x4.hpp>
 #include <Math/Plane.hpp>
 
 namespace MG3TR
 {
-    class Camera;
-
+    // Planes bounding a view volume, with normals pointing inwards.
     class Frustum
     {
     private:
@@ -20,7 +20,10 @@ namespace MG3TR
         Plane m_near_face;
 
     public:
-        Frustum(const Camera& camera);
+        Frustum() = default;
+        // Works for perspective and orthographic projections alike. The planes are in the space
+        // the matrix transforms from, i.e. world space for a view-projection matrix.
+        explicit Frustum(const Matrix4x4& view_projection);
         ~Frustum() = default;
 
         Frustum(const Frustum&) = default;
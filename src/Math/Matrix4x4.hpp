@@ -3,9 +3,14 @@
 
 #include "TMatrix4x4.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Matrix4x4 = MathInternal::TMatrix4x4<float>;
+
+    static_assert(std::is_trivially_copyable_v<Matrix4x4>);
+    static_assert(std::is_standard_layout_v<Matrix4x4>);
 }
 
 #endif // M3GTR_SRC_MATHMATRIX4X4_HPP_INCLUDED
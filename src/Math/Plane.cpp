@@ -11,7 +11,7 @@ namespace MG3TR
 
     Plane::Plane(const Vector3& normal, const Vector3& in_point)
         : m_normal(Vector3::Normalize(normal)),
-          m_distance(Vector3::Dot(normal, in_point))
+          m_distance(Vector3::Dot(m_normal, in_point))
     {
 
     }
@@ -3,9 +3,14 @@
 
 #include "TQuaternion.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Quaternion = MathInternal::TQuaternion<float>;
+
+    static_assert(std::is_trivially_copyable_v<Quaternion>);
+    static_assert(std::is_standard_layout_v<Quaternion>);
 }
 
 #endif // M3GTR_SRC_MATH_QUATERNION_HPP_INCLUDED
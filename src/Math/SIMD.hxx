@@ -0,0 +1,222 @@
+#ifndef M3GTR_SRC_MATH_SIMD_HXX_INCLUDED
+#define M3GTR_SRC_MATH_SIMD_HXX_INCLUDED
+
+// Thin wrapper over the 4 wide float registers of the target, so that the math kernels are
+// written once. SSE is used on x86 (with fused multiply-add when AVX2/FMA is enabled), NEON on
+// ARM, and plain arrays everywhere else.
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #define MG3TR_SIMD_SSE 1
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #define MG3TR_SIMD_NEON 1
+    #include <arm_neon.h>
+#else
+    #define MG3TR_SIMD_SCALAR 1
+    #include <array>
+    #include <cstddef>
+    #include <utility>
+#endif
+
+namespace MG3TR::MathInternal::SIMD
+{
+    struct TFloat4
+    {
+#if defined(MG3TR_SIMD_SSE)
+        __m128 m_value;
+#elif defined(MG3TR_SIMD_NEON)
+        float32x4_t m_value;
+#else
+        std::array<float, 4> m_value;
+#endif
+    };
+
+    inline TFloat4 Load(const float *const data);
+    inline void Store(float *const data, const TFloat4 v);
+
+    inline TFloat4 Set(const float x, const float y, const float z, const float w);
+    inline TFloat4 Splat(const float value);
+
+    inline TFloat4 Add(const TFloat4 a, const TFloat4 b);
+    inline TFloat4 Sub(const TFloat4 a, const TFloat4 b);
+    inline TFloat4 Mul(const TFloat4 a, const TFloat4 b);
+    // a * b + c
+    inline TFloat4 MulAdd(const TFloat4 a, const TFloat4 b, const TFloat4 c);
+
+    // Sum over all four lanes.
+    inline float Dot(const TFloat4 a, const TFloat4 b);
+    // Cross product of the xyz lanes; the w lane is 0 when both w lanes are 0.
+    inline TFloat4 Cross(const TFloat4 a, const TFloat4 b);
+
+    // Rows become columns.
+    inline void Transpose(TFloat4 &r0, TFloat4 &r1, TFloat4 &r2, TFloat4 &r3);
+}
+
+// Implementation
+namespace MG3TR::MathInternal::SIMD
+{
+    inline TFloat4 Load(const float *const data)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_loadu_ps(data) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vld1q_f32(data) };
+#else
+        const TFloat4 v{ { data[0], data[1], data[2], data[3] } };
+#endif
+        return v;
+    }
+
+    inline void Store(float *const data, const TFloat4 v)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        _mm_storeu_ps(data, v.m_value);
+#elif defined(MG3TR_SIMD_NEON)
+        vst1q_f32(data, v.m_value);
+#else
+        for (std::size_t i = 0; i < v.m_value.size(); ++i)
+        {
+            data[i] = v.m_value[i];
+        }
+#endif
+    }
+
+    inline TFloat4 Set(const float x, const float y, const float z, const float w)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_setr_ps(x, y, z, w) };
+#elif defined(MG3TR_SIMD_NEON)
+        const float data[] = { x, y, z, w };
+        const TFloat4 v{ vld1q_f32(data) };
+#else
+        const TFloat4 v{ { x, y, z, w } };
+#endif
+        return v;
+    }
+
+    inline TFloat4 Splat(const float value)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_set1_ps(value) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vdupq_n_f32(value) };
+#else
+        const TFloat4 v{ { value, value, value, value } };
+#endif
+        return v;
+    }
+
+    inline TFloat4 Add(const TFloat4 a, const TFloat4 b)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_add_ps(a.m_value, b.m_value) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vaddq_f32(a.m_value, b.m_value) };
+#else
+        const TFloat4 v{ { a.m_value[0] + b.m_value[0], a.m_value[1] + b.m_value[1],
+                           a.m_value[2] + b.m_value[2], a.m_value[3] + b.m_value[3] } };
+#endif
+        return v;
+    }
+
+    inline TFloat4 Sub(const TFloat4 a, const TFloat4 b)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_sub_ps(a.m_value, b.m_value) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vsubq_f32(a.m_value, b.m_value) };
+#else
+        const TFloat4 v{ { a.m_value[0] - b.m_value[0], a.m_value[1] - b.m_value[1],
+                           a.m_value[2] - b.m_value[2], a.m_value[3] - b.m_value[3] } };
+#endif
+        return v;
+    }
+
+    inline TFloat4 Mul(const TFloat4 a, const TFloat4 b)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const TFloat4 v{ _mm_mul_ps(a.m_value, b.m_value) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vmulq_f32(a.m_value, b.m_value) };
+#else
+        const TFloat4 v{ { a.m_value[0] * b.m_value[0], a.m_value[1] * b.m_value[1],
+                           a.m_value[2] * b.m_value[2], a.m_value[3] * b.m_value[3] } };
+#endif
+        return v;
+    }
+
+    inline TFloat4 MulAdd(const TFloat4 a, const TFloat4 b, const TFloat4 c)
+    {
+#if defined(MG3TR_SIMD_SSE) && defined(__FMA__)
+        const TFloat4 v{ _mm_fmadd_ps(a.m_value, b.m_value, c.m_value) };
+#elif defined(MG3TR_SIMD_NEON)
+        const TFloat4 v{ vmlaq_f32(c.m_value, a.m_value, b.m_value) };
+#else
+        const TFloat4 v = Add(Mul(a, b), c);
+#endif
+        return v;
+    }
+
+    inline float Dot(const TFloat4 a, const TFloat4 b)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const __m128 product = _mm_mul_ps(a.m_value, b.m_value);
+        const __m128 pairs = _mm_add_ps(product, _mm_movehl_ps(product, product));
+        const __m128 sum = _mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1)));
+        const float dot = _mm_cvtss_f32(sum);
+#elif defined(MG3TR_SIMD_NEON)
+        const float32x4_t product = vmulq_f32(a.m_value, b.m_value);
+        const float32x2_t pairs = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+        const float dot = vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+#else
+        const float dot = (a.m_value[0] * b.m_value[0]) + (a.m_value[1] * b.m_value[1])
+                        + (a.m_value[2] * b.m_value[2]) + (a.m_value[3] * b.m_value[3]);
+#endif
+        return dot;
+    }
+
+    inline TFloat4 Cross(const TFloat4 a, const TFloat4 b)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        const __m128 a_yzx = _mm_shuffle_ps(a.m_value, a.m_value, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 b_yzx = _mm_shuffle_ps(b.m_value, b.m_value, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 c_zxy = _mm_sub_ps(_mm_mul_ps(a.m_value, b_yzx), _mm_mul_ps(a_yzx, b.m_value));
+        const TFloat4 v{ _mm_shuffle_ps(c_zxy, c_zxy, _MM_SHUFFLE(3, 0, 2, 1)) };
+#elif defined(MG3TR_SIMD_NEON)
+        const float32x4_t a_yzx = __builtin_shufflevector(a.m_value, a.m_value, 1, 2, 0, 3);
+        const float32x4_t b_yzx = __builtin_shufflevector(b.m_value, b.m_value, 1, 2, 0, 3);
+        const float32x4_t c_zxy = vsubq_f32(vmulq_f32(a.m_value, b_yzx), vmulq_f32(a_yzx, b.m_value));
+        const TFloat4 v{ __builtin_shufflevector(c_zxy, c_zxy, 1, 2, 0, 3) };
+#else
+        const auto &u = a.m_value;
+        const auto &w = b.m_value;
+        const TFloat4 v{ { (u[1] * w[2]) - (u[2] * w[1]), (u[2] * w[0]) - (u[0] * w[2]),
+                           (u[0] * w[1]) - (u[1] * w[0]), 0.0F } };
+#endif
+        return v;
+    }
+
+    inline void Transpose(TFloat4 &r0, TFloat4 &r1, TFloat4 &r2, TFloat4 &r3)
+    {
+#if defined(MG3TR_SIMD_SSE)
+        _MM_TRANSPOSE4_PS(r0.m_value, r1.m_value, r2.m_value, r3.m_value);
+#elif defined(MG3TR_SIMD_NEON)
+        const float32x4x2_t t01 = vtrnq_f32(r0.m_value, r1.m_value);
+        const float32x4x2_t t23 = vtrnq_f32(r2.m_value, r3.m_value);
+        r0.m_value = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+        r1.m_value = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+        r2.m_value = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+        r3.m_value = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+#else
+        TFloat4 *const rows[] = { &r0, &r1, &r2, &r3 };
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            for (std::size_t j = i + 1; j < 4; ++j)
+            {
+                std::swap(rows[i]->m_value[j], rows[j]->m_value[i]);
+            }
+        }
+#endif
+    }
+}
+
+#endif // M3GTR_SRC_MATH_SIMD_HXX_INCLUDED
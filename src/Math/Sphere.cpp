@@ -1,5 +1,72 @@
 #include "Sphere.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+static const std::array<MG3TR::Vector3, 7> k_extreme_point_directions = {
+    MG3TR::Vector3(1.0F, 0.0F, 0.0F),
+    MG3TR::Vector3(0.0F, 1.0F, 0.0F),
+    MG3TR::Vector3(0.0F, 0.0F, 1.0F),
+    MG3TR::Vector3(1.0F, 1.0F, 1.0F),
+    MG3TR::Vector3(1.0F, 1.0F, -1.0F),
+    MG3TR::Vector3(1.0F, -1.0F, 1.0F),
+    MG3TR::Vector3(1.0F, -1.0F, -1.0F)
+};
+
+static MG3TR::Sphere CreateSphereFromExtremePoints(std::span<const MG3TR::Vector3> points)
+{
+    std::array<std::size_t, k_extreme_point_directions.size()> min_points{};
+    std::array<std::size_t, k_extreme_point_directions.size()> max_points{};
+    std::array<float, k_extreme_point_directions.size()> min_projections{};
+    std::array<float, k_extreme_point_directions.size()> max_projections{};
+
+    for (std::size_t direction = 0; direction < k_extreme_point_directions.size(); ++direction)
+    {
+        min_projections[direction] = MG3TR::Vector3::Dot(points[0], k_extreme_point_directions[direction]);
+        max_projections[direction] = min_projections[direction];
+    }
+
+    for (std::size_t i = 1; i < points.size(); ++i)
+    {
+        for (std::size_t direction = 0; direction < k_extreme_point_directions.size(); ++direction)
+        {
+            const float projection = MG3TR::Vector3::Dot(points[i], k_extreme_point_directions[direction]);
+
+            if (projection < min_projections[direction])
+            {
+                min_projections[direction] = projection;
+                min_points[direction] = i;
+            }
+            else if (projection > max_projections[direction])
+            {
+                max_projections[direction] = projection;
+                max_points[direction] = i;
+            }
+        }
+    }
+
+    std::size_t widest_direction = 0;
+    float widest_square_distance = -1.0F;
+
+    for (std::size_t direction = 0; direction < k_extreme_point_directions.size(); ++direction)
+    {
+        const float square_distance = (points[max_points[direction]] - points[min_points[direction]]).SquareMagnitude();
+
+        if (square_distance > widest_square_distance)
+        {
+            widest_square_distance = square_distance;
+            widest_direction = direction;
+        }
+    }
+
+    const MG3TR::Vector3 &min_point = points[min_points[widest_direction]];
+    const MG3TR::Vector3 &max_point = points[max_points[widest_direction]];
+    const MG3TR::Sphere sphere((min_point + max_point) * 0.5F, std::sqrt(widest_square_distance) * 0.5F);
+
+    return sphere;
+}
+
 namespace MG3TR
 {
     Sphere::Sphere(const Vector3& center, const float radius)
@@ -32,4 +99,43 @@ namespace MG3TR
         
         return is_on_or_in_front;
     }
+
+    Sphere Sphere::Enclosing(std::span<const Vector3> points)
+    {
+        if (points.empty())
+        {
+            const Sphere empty_sphere(Vector3(), 0.0F);
+            return empty_sphere;
+        }
+
+        const Sphere initial_sphere = CreateSphereFromExtremePoints(points);
+        Vector3 center = initial_sphere.GetCenter();
+        float radius = initial_sphere.GetRadius();
+
+        // Each point outside is covered by moving the center towards it and growing the radius by half the gap.
+        for (const auto &point : points)
+        {
+            const Vector3 to_point = point - center;
+            const float square_distance = to_point.SquareMagnitude();
+
+            if (square_distance > (radius * radius))
+            {
+                const float distance = std::sqrt(square_distance);
+                const float grown_radius = (radius + distance) * 0.5F;
+
+                center += to_point * ((grown_radius - radius) / distance);
+                radius = grown_radius;
+            }
+        }
+
+        // The growth steps round, so the radius is measured again from the final center.
+        float max_square_distance = 0.0F;
+        for (const auto &point : points)
+        {
+            max_square_distance = std::fmax(max_square_distance, (point - center).SquareMagnitude());
+        }
+
+        const Sphere sphere(center, std::sqrt(max_square_distance));
+        return sphere;
+    }
 }
\ No newline at end of file
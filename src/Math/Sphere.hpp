@@ -4,6 +4,8 @@
 #include <Math/Plane.hpp>
 #include <Math/Vector3.hpp>
 
+#include <span>
+
 namespace MG3TR
 {
     class Sphere
@@ -27,6 +29,11 @@ namespace MG3TR
         float GetRadius() const;
 
         bool IsOnOrInFrontOfPlane(const Plane& plane) const;
+
+        // Close to the smallest sphere containing the points, and never smaller. The sphere through the
+        // furthest pair of extreme points along 7 directions is grown to cover the rest (Ritter), then
+        // shrunk to the furthest point from its center.
+        static Sphere Enclosing(std::span<const Vector3> points);
     };
 }
 
@@ -1,6 +1,7 @@
 #ifndef M3GTR_SRC_MATH_TMATRIX4X4_HXX_INCLUDED
 #define M3GTR_SRC_MATH_TMATRIX4X4_HXX_INCLUDED
 
+#include "SIMD.hxx"
 #include "TQuaternion.hxx"
 #include "TVector3.hxx"
 #include "TVector4.hxx"
@@ -15,6 +16,7 @@
 #include <format>
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 namespace MG3TR::MathInternal
 {
@@ -24,21 +26,25 @@ namespace MG3TR::MathInternal
     private:
         glm::tmat4x4<TInternalType> m_mat4x4;
 
-        TMatrix4x4(const glm::tmat4x4<TInternalType>& mat4x4);
+        constexpr TMatrix4x4(const glm::tmat4x4<TInternalType>& mat4x4);
+
+        // Writes the affine inverse from the rows of the inverted 3x3 part, whose w lanes must be 0.
+        static void StoreAffineInverse(const SIMD::TFloat4 r0, const SIMD::TFloat4 r1, const SIMD::TFloat4 r2,
+                                       const float *const translation, float *const data);
 
     public:
-        TMatrix4x4(const TInternalType value_on_diagonal = static_cast<TInternalType>(0));
-        TMatrix4x4(const TInternalType m00, const TInternalType m01, const TInternalType m02, const TInternalType m03,
+        constexpr TMatrix4x4(const TInternalType value_on_diagonal = static_cast<TInternalType>(0));
+        constexpr TMatrix4x4(const TInternalType m00, const TInternalType m01, const TInternalType m02, const TInternalType m03,
                    const TInternalType m10, const TInternalType m11, const TInternalType m12, const TInternalType m13,
                    const TInternalType m20, const TInternalType m21, const TInternalType m22, const TInternalType m23,
                    const TInternalType m30, const TInternalType m31, const TInternalType m32, const TInternalType m33);
-        TMatrix4x4(const TVector4<TInternalType> &c0, const TVector4<TInternalType> &c1,
+        constexpr TMatrix4x4(const TVector4<TInternalType> &c0, const TVector4<TInternalType> &c1,
                    const TVector4<TInternalType> &c2, const TVector4<TInternalType> &c3);
-        TMatrix4x4(const TMatrix4x4<TInternalType> &m);
-        TMatrix4x4(TMatrix4x4<TInternalType> &&m);
+        TMatrix4x4(const TMatrix4x4<TInternalType> &m) = default;
+        TMatrix4x4(TMatrix4x4<TInternalType> &&m) = default;
 
-        TMatrix4x4<TInternalType>& operator=(const TMatrix4x4<TInternalType> &m);
-        TMatrix4x4<TInternalType>& operator=(TMatrix4x4<TInternalType> &&m);
+        TMatrix4x4<TInternalType>& operator=(const TMatrix4x4<TInternalType> &m) = default;
+        TMatrix4x4<TInternalType>& operator=(TMatrix4x4<TInternalType> &&m) = default;
 
         TVector4<TInternalType> operator[](const std::size_t index) const;
         TInternalType& operator[](const std::size_t row, const std::size_t col);
@@ -87,6 +93,19 @@ namespace MG3TR::MathInternal
         TMatrix4x4<TInternalType>& Inverse();
         static TMatrix4x4<TInternalType> Inverse(const TMatrix4x4<TInternalType> &m);
 
+        // Same result as Translate(position), Rotate(rotation) and Scale(scale) applied to the identity,
+        // without the matrix products.
+        static TMatrix4x4<TInternalType> FromTRS(const TVector3<TInternalType> &position,
+                                                 const TQuaternion<TInternalType> &rotation,
+                                                 const TVector3<TInternalType> &scale);
+
+        // The last row of m must be (0, 0, 0, 1).
+        static TMatrix4x4<TInternalType> InverseAffine(const TMatrix4x4<TInternalType> &m);
+        // m must be built from a translation, a rotation and a scale, e.g. by FromTRS. The columns of its
+        // 3x3 part are then orthogonal, so that part is inverted by transposing it and dividing each row
+        // by its squared length.
+        static TMatrix4x4<TInternalType> InverseTRS(const TMatrix4x4<TInternalType> &m);
+
         template<TNumericalConcept TOtherInternalType>
         TMatrix4x4<TInternalType>& operator+=(const TMatrix4x4<TOtherInternalType> &m);
 
@@ -169,21 +188,21 @@ namespace MG3TR::MathInternal
 namespace MG3TR::MathInternal
 {
     template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(const glm::tmat4x4<TInternalType> &mat4x4)
+    constexpr TMatrix4x4<TInternalType>::TMatrix4x4(const glm::tmat4x4<TInternalType> &mat4x4)
         : m_mat4x4(mat4x4)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(const TInternalType value_on_diagonal)
+    constexpr TMatrix4x4<TInternalType>::TMatrix4x4(const TInternalType value_on_diagonal)
         : m_mat4x4(value_on_diagonal)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(const TInternalType m00, const TInternalType m01, const TInternalType m02, const TInternalType m03,
+    constexpr TMatrix4x4<TInternalType>::TMatrix4x4(const TInternalType m00, const TInternalType m01, const TInternalType m02, const TInternalType m03,
                                           const TInternalType m10, const TInternalType m11, const TInternalType m12, const TInternalType m13,
                                           const TInternalType m20, const TInternalType m21, const TInternalType m22, const TInternalType m23,
                                           const TInternalType m30, const TInternalType m31, const TInternalType m32, const TInternalType m33)
@@ -196,7 +215,7 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(const TVector4<TInternalType> &c0, const TVector4<TInternalType> &c1,
+    constexpr TMatrix4x4<TInternalType>::TMatrix4x4(const TVector4<TInternalType> &c0, const TVector4<TInternalType> &c1,
                                           const TVector4<TInternalType> &c2, const TVector4<TInternalType> &c3)
         : m_mat4x4(c0.x(), c0.y(), c0.z(), c0.w(),
                    c1.x(), c1.y(), c1.z(), c1.w(),
@@ -206,34 +225,6 @@ namespace MG3TR::MathInternal
 
     }
 
-    template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(const TMatrix4x4<TInternalType> &m)
-        : m_mat4x4(m.m_mat4x4)
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>::TMatrix4x4(TMatrix4x4<TInternalType> &&m)
-        : m_mat4x4(std::move(m.m_mat4x4))
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>& TMatrix4x4<TInternalType>::operator=(const TMatrix4x4<TInternalType> &m)
-    {
-        m_mat4x4 = m.m_mat4x4;
-        return *this;
-    }
-
-    template<TNumericalConcept TInternalType>
-    TMatrix4x4<TInternalType>& TMatrix4x4<TInternalType>::operator=(TMatrix4x4<TInternalType> &&m)
-    {
-        m_mat4x4 = std::move(m.m_mat4x4);
-        return *this;
-    }
-
     template<TNumericalConcept TInternalType>
     TVector4<TInternalType> TMatrix4x4<TInternalType>::operator[](const std::size_t index) const
     {
@@ -467,6 +458,109 @@ namespace MG3TR::MathInternal
         return mat;
     }
 
+    template<TNumericalConcept TInternalType>
+    TMatrix4x4<TInternalType> TMatrix4x4<TInternalType>::FromTRS(const TVector3<TInternalType> &position,
+                                                                 const TQuaternion<TInternalType> &rotation,
+                                                                 const TVector3<TInternalType> &scale)
+    {
+        const auto zero = static_cast<TInternalType>(0);
+        const auto one = static_cast<TInternalType>(1);
+
+        const glm::tquat<TInternalType> qu(rotation.w(), rotation.x(), rotation.y(), rotation.z());
+        const glm::tmat3x3<TInternalType> rotation_mat3 = glm::mat3_cast(qu);
+
+        const glm::tmat4x4<TInternalType> mat4(glm::tvec4<TInternalType>(rotation_mat3[0] * scale.x(), zero),
+                                              glm::tvec4<TInternalType>(rotation_mat3[1] * scale.y(), zero),
+                                              glm::tvec4<TInternalType>(rotation_mat3[2] * scale.z(), zero),
+                                              glm::tvec4<TInternalType>(position.x(), position.y(), position.z(), one));
+        const TMatrix4x4<TInternalType> mat(mat4);
+        return mat;
+    }
+
+    template<TNumericalConcept TInternalType>
+    TMatrix4x4<TInternalType> TMatrix4x4<TInternalType>::InverseAffine(const TMatrix4x4<TInternalType> &m)
+    {
+        TMatrix4x4<TInternalType> mat;
+
+        if constexpr (std::is_same_v<TInternalType, float>)
+        {
+            const float *const data = m.InternalDataPointer();
+            const SIMD::TFloat4 c0 = SIMD::Load(data);
+            const SIMD::TFloat4 c1 = SIMD::Load(data + 4);
+            const SIMD::TFloat4 c2 = SIMD::Load(data + 8);
+
+            // The rows of the inverse are the cross products of the columns over the determinant.
+            const SIMD::TFloat4 c1_cross_c2 = SIMD::Cross(c1, c2);
+            const SIMD::TFloat4 inverse_determinant = SIMD::Splat(1.0F / SIMD::Dot(c0, c1_cross_c2));
+
+            const SIMD::TFloat4 r0 = SIMD::Mul(c1_cross_c2, inverse_determinant);
+            const SIMD::TFloat4 r1 = SIMD::Mul(SIMD::Cross(c2, c0), inverse_determinant);
+            const SIMD::TFloat4 r2 = SIMD::Mul(SIMD::Cross(c0, c1), inverse_determinant);
+
+            StoreAffineInverse(r0, r1, r2, data + 12, mat.InternalDataPointer());
+        }
+        else
+        {
+            const auto one = static_cast<TInternalType>(1);
+
+            const glm::tmat3x3<TInternalType> inverse_mat3 = glm::inverse(glm::tmat3x3<TInternalType>(m.m_mat4x4));
+            const glm::tvec3<TInternalType> translation(m.m_mat4x4[3]);
+
+            mat.m_mat4x4 = glm::tmat4x4<TInternalType>(inverse_mat3);
+            mat.m_mat4x4[3] = glm::tvec4<TInternalType>(-(inverse_mat3 * translation), one);
+        }
+
+        return mat;
+    }
+
+    template<TNumericalConcept TInternalType>
+    TMatrix4x4<TInternalType> TMatrix4x4<TInternalType>::InverseTRS(const TMatrix4x4<TInternalType> &m)
+    {
+        TMatrix4x4<TInternalType> mat;
+
+        if constexpr (std::is_same_v<TInternalType, float>)
+        {
+            const float *const data = m.InternalDataPointer();
+            const SIMD::TFloat4 c0 = SIMD::Load(data);
+            const SIMD::TFloat4 c1 = SIMD::Load(data + 4);
+            const SIMD::TFloat4 c2 = SIMD::Load(data + 8);
+
+            const SIMD::TFloat4 r0 = SIMD::Mul(c0, SIMD::Splat(1.0F / SIMD::Dot(c0, c0)));
+            const SIMD::TFloat4 r1 = SIMD::Mul(c1, SIMD::Splat(1.0F / SIMD::Dot(c1, c1)));
+            const SIMD::TFloat4 r2 = SIMD::Mul(c2, SIMD::Splat(1.0F / SIMD::Dot(c2, c2)));
+
+            StoreAffineInverse(r0, r1, r2, data + 12, mat.InternalDataPointer());
+        }
+        else
+        {
+            mat = InverseAffine(m);
+        }
+
+        return mat;
+    }
+
+    template<TNumericalConcept TInternalType>
+    void TMatrix4x4<TInternalType>::StoreAffineInverse(const SIMD::TFloat4 r0, const SIMD::TFloat4 r1,
+                                                       const SIMD::TFloat4 r2, const float *const translation,
+                                                       float *const data)
+    {
+        SIMD::TFloat4 c0 = r0;
+        SIMD::TFloat4 c1 = r1;
+        SIMD::TFloat4 c2 = r2;
+        SIMD::TFloat4 c3 = SIMD::Set(0.0F, 0.0F, 0.0F, 1.0F);
+        SIMD::Transpose(c0, c1, c2, c3);
+
+        // The inverse translation is -(inverse 3x3 part * translation).
+        SIMD::TFloat4 rotated_translation = SIMD::Mul(c0, SIMD::Splat(translation[0]));
+        rotated_translation = SIMD::MulAdd(c1, SIMD::Splat(translation[1]), rotated_translation);
+        rotated_translation = SIMD::MulAdd(c2, SIMD::Splat(translation[2]), rotated_translation);
+
+        SIMD::Store(data, c0);
+        SIMD::Store(data + 4, c1);
+        SIMD::Store(data + 8, c2);
+        SIMD::Store(data + 12, SIMD::Sub(c3, rotated_translation));
+    }
+
     template<TNumericalConcept TInternalType>
     template<TNumericalConcept TOtherInternalType>
     TMatrix4x4<TInternalType>& TMatrix4x4<TInternalType>::operator+=(const TMatrix4x4<TOtherInternalType> &m)
@@ -22,22 +22,22 @@ namespace MG3TR::MathInternal
     private:
         glm::tquat<TInternalType> m_quat;
 
-        TQuaternion(const glm::tquat<TInternalType> &quat);
+        constexpr TQuaternion(const glm::tquat<TInternalType> &quat);
 
     public:
-        TQuaternion();
-        TQuaternion(const TInternalType s, const TVector3<TInternalType> &v);
-        TQuaternion(const TInternalType w, TInternalType x, TInternalType y, TInternalType z);
+        constexpr TQuaternion();
+        constexpr TQuaternion(const TInternalType s, const TVector3<TInternalType> &v);
+        constexpr TQuaternion(const TInternalType w, TInternalType x, TInternalType y, TInternalType z);
         // from and to must be normalized
         TQuaternion(const TVector3<TInternalType> &from, const TVector3<TInternalType> &to);
         TQuaternion(const TVector3<TInternalType> &euler_angles);
         static TQuaternion<TInternalType> FromAngleAxis(const TInternalType angle,
                                                         const TVector3<TInternalType> &axis);
-        TQuaternion(const TQuaternion<TInternalType> &q);
-        TQuaternion(TQuaternion<TInternalType> &&q);
+        TQuaternion(const TQuaternion<TInternalType> &q) = default;
+        TQuaternion(TQuaternion<TInternalType> &&q) = default;
 
-        TQuaternion<TInternalType>& operator=(const TQuaternion<TInternalType> &q);
-        TQuaternion<TInternalType>& operator=(TQuaternion<TInternalType> &&q);
+        TQuaternion<TInternalType>& operator=(const TQuaternion<TInternalType> &q) = default;
+        TQuaternion<TInternalType>& operator=(TQuaternion<TInternalType> &&q) = default;
 
         TInternalType& operator[](const std::size_t index);
         const TInternalType& operator[](const std::size_t index) const;
@@ -50,15 +50,19 @@ namespace MG3TR::MathInternal
         TInternalType& y();
         TInternalType& z();
 
-        TInternalType w() const;
-        TInternalType x() const;
-        TInternalType y() const;
-        TInternalType z() const;
+        constexpr TInternalType w() const;
+        constexpr TInternalType x() const;
+        constexpr TInternalType y() const;
+        constexpr TInternalType z() const;
 
         static std::size_t Size();
 
         TQuaternion<TInternalType>& Set(const TInternalType w, const TInternalType x, const TInternalType y, const TInternalType z);
 
+        // The components are stored in x, y, z, w order.
+        TInternalType* InternalDataPointer();
+        const TInternalType* InternalDataPointer() const;
+
         TInternalType Angle() const;
         static TInternalType Angle(const TQuaternion<TInternalType> &q);
 
@@ -113,14 +117,14 @@ namespace MG3TR::MathInternal
 namespace MG3TR::MathInternal
 {
     template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion(const glm::tquat<TInternalType> &quat)
+    constexpr TQuaternion<TInternalType>::TQuaternion(const glm::tquat<TInternalType> &quat)
         : m_quat(quat)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion()
+    constexpr TQuaternion<TInternalType>::TQuaternion()
         : m_quat(static_cast<TInternalType>(1), static_cast<TInternalType>(0),
                  static_cast<TInternalType>(0), static_cast<TInternalType>(0))
     {
@@ -128,14 +132,14 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion(const TInternalType s, const TVector3<TInternalType> &v)
+    constexpr TQuaternion<TInternalType>::TQuaternion(const TInternalType s, const TVector3<TInternalType> &v)
         : m_quat(s, v.x(), v.y(), v.z())
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion(const TInternalType w, const TInternalType x,
+    constexpr TQuaternion<TInternalType>::TQuaternion(const TInternalType w, const TInternalType x,
                                             const TInternalType y, const TInternalType z)
         : m_quat(w, x, y, z)
     {
@@ -168,34 +172,6 @@ namespace MG3TR::MathInternal
         return q;
     }
 
-    template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion(const TQuaternion<TInternalType> &q)
-        : m_quat(q.m_quat)
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>::TQuaternion(TQuaternion<TInternalType> &&q)
-        : m_quat(std::move(q.m_quat))
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>& TQuaternion<TInternalType>::operator=(const TQuaternion<TInternalType> &q)
-    {
-        m_quat = q.m_quat;
-        return *this;
-    }
-
-    template<TNumericalConcept TInternalType>
-    TQuaternion<TInternalType>& TQuaternion<TInternalType>::operator=(TQuaternion<TInternalType> &&q)
-    {
-        m_quat = std::move(q.m_quat);
-        return *this;
-    }
-
     template<TNumericalConcept TInternalType>
     TInternalType& TQuaternion<TInternalType>::operator[](const std::size_t index)
     {
@@ -265,25 +241,25 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TQuaternion<TInternalType>::w() const
+    constexpr TInternalType TQuaternion<TInternalType>::w() const
     {
         return m_quat.w;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TQuaternion<TInternalType>::x() const
+    constexpr TInternalType TQuaternion<TInternalType>::x() const
     {
         return m_quat.x;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TQuaternion<TInternalType>::y() const
+    constexpr TInternalType TQuaternion<TInternalType>::y() const
     {
         return m_quat.y;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TQuaternion<TInternalType>::z() const
+    constexpr TInternalType TQuaternion<TInternalType>::z() const
     {
         return m_quat.z;
     }
@@ -305,6 +281,20 @@ namespace MG3TR::MathInternal
         return *this;
     }
 
+    template<TNumericalConcept TInternalType>
+    TInternalType* TQuaternion<TInternalType>::InternalDataPointer()
+    {
+        TInternalType* const value = &m_quat.x;
+        return value;
+    }
+
+    template<TNumericalConcept TInternalType>
+    const TInternalType* TQuaternion<TInternalType>::InternalDataPointer() const
+    {
+        const TInternalType* const value = &m_quat.x;
+        return value;
+    }
+
     template<TNumericalConcept TInternalType>
     TInternalType TQuaternion<TInternalType>::Angle() const
     {
@@ -22,16 +22,16 @@ namespace MG3TR::MathInternal
     private:
         glm::tvec2<TInternalType> m_vec2;
 
-        TVector2(const glm::tvec2<TInternalType> &v);
+        constexpr TVector2(const glm::tvec2<TInternalType> &v);
 
     public:
-        TVector2();
-        TVector2(const TInternalType x, const TInternalType y);
-        TVector2(const TVector2<TInternalType> &v);
-        TVector2(TVector2<TInternalType> &&v);
+        constexpr TVector2();
+        constexpr TVector2(const TInternalType x, const TInternalType y);
+        TVector2(const TVector2<TInternalType> &v) = default;
+        TVector2(TVector2<TInternalType> &&v) = default;
 
-        TVector2<TInternalType>& operator=(const TVector2<TInternalType> &v);
-        TVector2<TInternalType>& operator=(TVector2<TInternalType> &&v);
+        TVector2<TInternalType>& operator=(const TVector2<TInternalType> &v) = default;
+        TVector2<TInternalType>& operator=(TVector2<TInternalType> &&v) = default;
 
         TInternalType& operator[](const std::size_t index);
         const TInternalType& operator[](const std::size_t index) const;
@@ -42,8 +42,8 @@ namespace MG3TR::MathInternal
         TInternalType& x();
         TInternalType& y();
 
-        TInternalType x() const;
-        TInternalType y() const;
+        constexpr TInternalType x() const;
+        constexpr TInternalType y() const;
 
         static std::size_t Size();
         
@@ -152,54 +152,26 @@ namespace MG3TR::MathInternal
 namespace MG3TR::MathInternal
 {
     template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>::TVector2(const glm::tvec2<TInternalType> &v)
+    constexpr TVector2<TInternalType>::TVector2(const glm::tvec2<TInternalType> &v)
         : m_vec2(v)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>::TVector2()
+    constexpr TVector2<TInternalType>::TVector2()
         : m_vec2(static_cast<TInternalType>(0), static_cast<TInternalType>(0))
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>::TVector2(const TInternalType x, const TInternalType y)
+    constexpr TVector2<TInternalType>::TVector2(const TInternalType x, const TInternalType y)
         : m_vec2(x, y)
     {
 
     }
 
-    template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>::TVector2(const TVector2<TInternalType> &v)
-        : m_vec2(v.m_vec2)
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>::TVector2(TVector2<TInternalType> &&v)
-        : m_vec2(std::move(v.m_vec2))
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>& TVector2<TInternalType>::operator=(const TVector2<TInternalType> &v)
-    {
-        m_vec2 = v.m_vec2;
-        return *this;
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector2<TInternalType>& TVector2<TInternalType>::operator=(TVector2<TInternalType> &&v)
-    {
-        m_vec2 = std::move(v.m_vec2);
-        return *this;
-    }
-
     template<TNumericalConcept TInternalType>
     TInternalType& TVector2<TInternalType>::operator[](const std::size_t index)
     {
@@ -256,13 +228,13 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector2<TInternalType>::x() const
+    constexpr TInternalType TVector2<TInternalType>::x() const
     {
         return m_vec2.x;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector2<TInternalType>::y() const
+    constexpr TInternalType TVector2<TInternalType>::y() const
     {
         return m_vec2.y;
     }
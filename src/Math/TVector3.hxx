@@ -23,16 +23,16 @@ namespace MG3TR::MathInternal
     private:
         glm::tvec3<TInternalType> m_vec3;
 
-        TVector3(const glm::tvec3<TInternalType> &v);
+        constexpr TVector3(const glm::tvec3<TInternalType> &v);
 
     public:
-        TVector3();
-        TVector3(const TInternalType x, const TInternalType y, const TInternalType z);
-        TVector3(const TVector3<TInternalType> &v);
-        TVector3(TVector3<TInternalType> &&v);
+        constexpr TVector3();
+        constexpr TVector3(const TInternalType x, const TInternalType y, const TInternalType z);
+        TVector3(const TVector3<TInternalType> &v) = default;
+        TVector3(TVector3<TInternalType> &&v) = default;
 
-        TVector3<TInternalType>& operator=(const TVector3<TInternalType> &v);
-        TVector3<TInternalType>& operator=(TVector3<TInternalType> &&v);
+        TVector3<TInternalType>& operator=(const TVector3<TInternalType> &v) = default;
+        TVector3<TInternalType>& operator=(TVector3<TInternalType> &&v) = default;
 
         TInternalType& operator[](const std::size_t index);
         const TInternalType& operator[](const std::size_t index) const;
@@ -44,9 +44,9 @@ namespace MG3TR::MathInternal
         TInternalType& y();
         TInternalType& z();
 
-        TInternalType x() const;
-        TInternalType y() const;
-        TInternalType z() const;
+        constexpr TInternalType x() const;
+        constexpr TInternalType y() const;
+        constexpr TInternalType z() const;
 
         static std::size_t Size();
 
@@ -115,8 +115,8 @@ namespace MG3TR::MathInternal
         template<TNumericalConcept TOtherInternalType>
         TVector3<TInternalType>& operator/=(const TOtherInternalType scalar);
 
-        bool operator==(const TVector3<TInternalType> &v);
-        bool operator!=(const TVector3<TInternalType> &v);
+        bool operator==(const TVector3<TInternalType> &v) const;
+        bool operator!=(const TVector3<TInternalType> &v) const;
 
         template<TNumericalConcept TInternal>
         friend TVector3<TInternal> operator+(const TVector3<TInternal> &v);
@@ -170,54 +170,26 @@ namespace MG3TR::MathInternal
 namespace MG3TR::MathInternal
 {
     template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>::TVector3(const glm::tvec3<TInternalType> &v)
+    constexpr TVector3<TInternalType>::TVector3(const glm::tvec3<TInternalType> &v)
         : m_vec3(v)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>::TVector3()
+    constexpr TVector3<TInternalType>::TVector3()
         : m_vec3(static_cast<TInternalType>(0), static_cast<TInternalType>(0), static_cast<TInternalType>(0))
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>::TVector3(const TInternalType x, const TInternalType y, const TInternalType z)
+    constexpr TVector3<TInternalType>::TVector3(const TInternalType x, const TInternalType y, const TInternalType z)
         : m_vec3(x, y, z)
     {
 
     }
 
-    template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>::TVector3(const TVector3<TInternalType> &v)
-        : m_vec3(v.m_vec3)
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>::TVector3(TVector3<TInternalType> &&v)
-        : m_vec3(std::move(v.m_vec3))
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>& TVector3<TInternalType>::operator=(const TVector3<TInternalType> &v)
-    {
-        m_vec3 = v.m_vec3;
-        return *this;
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector3<TInternalType>& TVector3<TInternalType>::operator=(TVector3<TInternalType> &&v)
-    {
-        m_vec3 = std::move(v.m_vec3);
-        return *this;
-    }
-
     template<TNumericalConcept TInternalType>
     TInternalType& TVector3<TInternalType>::operator[](const std::size_t index)
     {
@@ -281,19 +253,19 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector3<TInternalType>::x() const
+    constexpr TInternalType TVector3<TInternalType>::x() const
     {
         return m_vec3.x;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector3<TInternalType>::y() const
+    constexpr TInternalType TVector3<TInternalType>::y() const
     {
         return m_vec3.y;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector3<TInternalType>::z() const
+    constexpr TInternalType TVector3<TInternalType>::z() const
     {
         return m_vec3.z;
     }
@@ -372,7 +344,7 @@ namespace MG3TR::MathInternal
     {
         static_assert(std::numeric_limits<TInternalType>::is_iec559, "'Dot' accepts only floating-point inputs");
         
-        const auto dot = glm::distance(m_vec3, v.m_vec3);
+        const auto dot = glm::dot(m_vec3, v.m_vec3);
         return dot;
     }
 
@@ -382,7 +354,7 @@ namespace MG3TR::MathInternal
     {
         static_assert(std::numeric_limits<TInternalType>::is_iec559, "'Dot' accepts only floating-point inputs");
         
-        const auto dot = glm::distance(v1.m_vec3, v2.m_vec3);
+        const auto dot = glm::dot(v1.m_vec3, v2.m_vec3);
         return dot;
     }
 
@@ -590,14 +562,14 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    bool TVector3<TInternalType>::operator==(const TVector3<TInternalType> &v)
+    bool TVector3<TInternalType>::operator==(const TVector3<TInternalType> &v) const
     {
         const bool are_equal = (m_vec3 == v.m_vec3);
         return are_equal;
     }
 
     template<TNumericalConcept TInternalType>
-    bool TVector3<TInternalType>::operator!=(const TVector3<TInternalType> &v)
+    bool TVector3<TInternalType>::operator!=(const TVector3<TInternalType> &v) const
     {
         const bool are_not_equal = (m_vec3 != v.m_vec3);
         return are_not_equal;
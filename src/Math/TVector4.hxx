@@ -22,17 +22,17 @@ namespace MG3TR::MathInternal
     private:
         glm::tvec4<TInternalType> m_vec4;
 
-        TVector4(const glm::tvec4<TInternalType> &v);
+        constexpr TVector4(const glm::tvec4<TInternalType> &v);
 
     public:
-        TVector4();
-        TVector4(const TInternalType x, const TInternalType y, const TInternalType z, const TInternalType w);
-        TVector4(const TVector3<TInternalType> &v, TInternalType w);
-        TVector4(const TVector4<TInternalType> &v);
-        TVector4(TVector4<TInternalType> &&v);
+        constexpr TVector4();
+        constexpr TVector4(const TInternalType x, const TInternalType y, const TInternalType z, const TInternalType w);
+        constexpr TVector4(const TVector3<TInternalType> &v, TInternalType w);
+        TVector4(const TVector4<TInternalType> &v) = default;
+        TVector4(TVector4<TInternalType> &&v) = default;
 
-        TVector4<TInternalType>& operator=(const TVector4<TInternalType> &v);
-        TVector4<TInternalType>& operator=(TVector4<TInternalType> &&v);
+        TVector4<TInternalType>& operator=(const TVector4<TInternalType> &v) = default;
+        TVector4<TInternalType>& operator=(TVector4<TInternalType> &&v) = default;
 
         TInternalType& operator[](const std::size_t index);
         const TInternalType& operator[](const std::size_t index) const;
@@ -45,10 +45,10 @@ namespace MG3TR::MathInternal
         TInternalType& z();
         TInternalType& w();
 
-        TInternalType x() const;
-        TInternalType y() const;
-        TInternalType z() const;
-        TInternalType w() const;
+        constexpr TInternalType x() const;
+        constexpr TInternalType y() const;
+        constexpr TInternalType z() const;
+        constexpr TInternalType w() const;
 
         static std::size_t Size();
 
@@ -146,14 +146,14 @@ namespace MG3TR::MathInternal
 namespace MG3TR::MathInternal
 {
     template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4(const glm::tvec4<TInternalType> &v)
+    constexpr TVector4<TInternalType>::TVector4(const glm::tvec4<TInternalType> &v)
         : m_vec4(v)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4()
+    constexpr TVector4<TInternalType>::TVector4()
         : m_vec4(static_cast<TInternalType>(0), static_cast<TInternalType>(0),
                  static_cast<TInternalType>(0), static_cast<TInternalType>(0))
     {
@@ -161,47 +161,19 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4(const TInternalType x, const TInternalType y, const TInternalType z, const TInternalType w)
+    constexpr TVector4<TInternalType>::TVector4(const TInternalType x, const TInternalType y, const TInternalType z, const TInternalType w)
         : m_vec4(x, y, z, w)
     {
 
     }
 
     template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4(const TVector3<TInternalType> &v, const TInternalType w)
+    constexpr TVector4<TInternalType>::TVector4(const TVector3<TInternalType> &v, const TInternalType w)
         : m_vec4(v.x(), v.y(), v.z(), w)
     {
 
     }
 
-    template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4(const TVector4<TInternalType> &v)
-        : m_vec4(v.m_vec4)
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>::TVector4(TVector4<TInternalType> &&v)
-        : m_vec4(std::move(v.m_vec4))
-    {
-
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>& TVector4<TInternalType>::operator=(const TVector4<TInternalType> &v)
-    {
-        m_vec4 = v.m_vec4;
-        return *this;
-    }
-
-    template<TNumericalConcept TInternalType>
-    TVector4<TInternalType>& TVector4<TInternalType>::operator=(TVector4<TInternalType> &&v)
-    {
-        m_vec4 = std::move(v.m_vec4);
-        return *this;
-    }
-
     template<TNumericalConcept TInternalType>
     TInternalType& TVector4<TInternalType>::operator[](const std::size_t index)
     {
@@ -271,25 +243,25 @@ namespace MG3TR::MathInternal
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector4<TInternalType>::x() const
+    constexpr TInternalType TVector4<TInternalType>::x() const
     {
         return m_vec4.x;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector4<TInternalType>::y() const
+    constexpr TInternalType TVector4<TInternalType>::y() const
     {
         return m_vec4.y;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector4<TInternalType>::z() const
+    constexpr TInternalType TVector4<TInternalType>::z() const
     {
         return m_vec4.z;
     }
 
     template<TNumericalConcept TInternalType>
-    TInternalType TVector4<TInternalType>::w() const
+    constexpr TInternalType TVector4<TInternalType>::w() const
     {
         return m_vec4.w;
     }
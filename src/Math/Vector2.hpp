@@ -3,9 +3,14 @@
 
 #include "TVector2.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Vector2 = MathInternal::TVector2<float>;
+
+    static_assert(std::is_trivially_copyable_v<Vector2>);
+    static_assert(std::is_standard_layout_v<Vector2>);
 }
 
 #endif // M3GTR_SRC_MATH_VECTOR2_HPP_INCLUDED
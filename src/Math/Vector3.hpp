@@ -3,9 +3,14 @@
 
 #include "TVector3.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Vector3 = MathInternal::TVector3<float>;
+
+    static_assert(std::is_trivially_copyable_v<Vector3>);
+    static_assert(std::is_standard_layout_v<Vector3>);
 }
 
 #endif // M3GTR_SRC_MATH_VECTOR3_HPP_INCLUDED
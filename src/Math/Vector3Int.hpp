@@ -3,9 +3,14 @@
 
 #include "TVector3.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Vector3Int = MathInternal::TVector3<int>;
+
+    static_assert(std::is_trivially_copyable_v<Vector3Int>);
+    static_assert(std::is_standard_layout_v<Vector3Int>);
 }
 
 #endif // M3GTR_SRC_MATH_VECTOR3_HPP_INCLUDED
@@ -3,9 +3,14 @@
 
 #include "TVector4.hxx"
 
+#include <type_traits>
+
 namespace MG3TR
 {
     using Vector4 = MathInternal::TVector4<float>;
+
+    static_assert(std::is_trivially_copyable_v<Vector4>);
+    static_assert(std::is_standard_layout_v<Vector4>);
 }
 
 #endif // M4GTR_SRC_MATH_VECTOR4_HPP_INCLUDED
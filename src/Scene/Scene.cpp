@@ -1,17 +1,26 @@
 #include "Scene.hpp"
 
 #include <Components/Camera.hpp>
+#include <Components/MeshRenderer.hpp>
 #include <Constants/SerialisationConstants.hpp>
+#include <Constants/UtilsConstants.hpp>
+#include <Graphics/FrustumCuller.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Scripting/GameObject.hpp>
 #include <Scripting/Transform.hpp>
 #include <Serialisation/JSONDeserialiser.hpp>
 #include <Serialisation/JSONSerialiser.hpp>
+#include <Utils/JobSystem.hpp>
 #include <Window/Input.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <iomanip>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 static void CallInitialize(MG3TR::Transform &root_transform)
 {
@@ -30,122 +39,60 @@ static void CallInitialize(MG3TR::Transform &root_transform)
     }
 }
 
-static void CallParseInput(MG3TR::Transform &root_transform, const MG3TR::Input &input)
+// Submitted from the lists of the scene, which only hold the components attached to it. They are
+// kept in address order, which walks each pool block by block, in storage order.
+//
+// Cameras and mesh renderers only read the transforms, and record into separate lists of the frame,
+// so they are submitted in parallel. The culler draws the proxies the mesh renderers submitted, and
+// runs after the cameras too, since it may release the last reference to a camera.
+// Erases the entry of the object, and not the other objects listed under the same key.
+template<typename Key, typename Object>
+static void EraseLookupEntry(std::unordered_multimap<Key, std::weak_ptr<Object>> &index, const Key &key,
+                             const std::shared_ptr<Object> &object)
 {
-    auto game_object = root_transform.GetGameObject();
-    if (game_object != nullptr)
+    const auto [begin, end] = index.equal_range(key);
+    for (auto iterator = begin; iterator != end; ++iterator)
     {
-        for (auto &component : game_object->GetComponents())
+        const bool is_same = !iterator->second.owner_before(object) && !object.owner_before(iterator->second);
+        if (is_same)
         {
-            component->ParseInput(input);
+            (void)index.erase(iterator);
+            return;
         }
     }
-
-    for (auto &child : root_transform.GetChildren())
-    {
-        CallParseInput(*child, input);
-    }
 }
 
-static void CallFrameStart(MG3TR::Transform &root_transform, const float delta_time)
-{
-    auto game_object = root_transform.GetGameObject();
-    if (game_object != nullptr)
-    {
-        for (auto &component : game_object->GetComponents())
-        {
-            component->FrameStart(delta_time);
-        }
-    }
 
-    for (auto &child : root_transform.GetChildren())
-    {
-        CallFrameStart(*child, delta_time);
-    }
-}
 
-static void CallFrameUpdate(MG3TR::Transform &root_transform, const float delta_time)
+static MG3TR::JobGraph CreateSubmissionGraph(const std::vector<MG3TR::Camera*> &cameras,
+                                             const std::vector<MG3TR::MeshRenderer*> &mesh_renderers)
 {
-    auto game_object = root_transform.GetGameObject();
-    if (game_object != nullptr)
-    {
-        for (auto &component : game_object->GetComponents())
-        {
-            component->FrameUpdate(delta_time);
-        }
-    }
-
-    for (auto &child : root_transform.GetChildren())
-    {
-        CallFrameUpdate(*child, delta_time);
-    }
-}
+    MG3TR::JobGraph graph;
 
-static void CallFrameEnd(MG3TR::Transform &root_transform, const float delta_time)
-{
-    auto game_object = root_transform.GetGameObject();
-    if (game_object != nullptr)
+    const MG3TR::TJobID cameras_job = graph.AddJob([&cameras]()
     {
-        for (auto &component : game_object->GetComponents())
+        for (const MG3TR::Camera *const camera : cameras)
         {
-            component->FrameEnd(delta_time);
+            camera->SubmitToRenderQueue();
         }
-    }
-
-    for (auto &child : root_transform.GetChildren())
-    {
-        CallFrameEnd(*child, delta_time);
-    }
-}
+    });
 
-static std::shared_ptr<MG3TR::Camera> FindCameraWithUID(const std::shared_ptr<MG3TR::Transform> &transform, MG3TR::TUID uid)
-{
-    if (transform->GetGameObject() != nullptr)
+    const MG3TR::TJobID mesh_renderers_job = graph.AddJob([&mesh_renderers]()
     {
-        for (auto &component : transform->GetGameObject()->GetComponents())
+        for (MG3TR::MeshRenderer *const mesh_renderer : mesh_renderers)
         {
-            if (component->GetUID() == uid)
-            {
-                return std::dynamic_pointer_cast<MG3TR::Camera>(component);
-            }
+            mesh_renderer->SubmitToRenderQueue();
         }
-    }
+    });
 
-    std::shared_ptr<MG3TR::Camera> found_camera = nullptr;
-
-    for (auto &child : transform->GetChildren())
+    const MG3TR::TJobID culling_job = graph.AddJob([]()
     {
-        auto camera = FindCameraWithUID(child, uid);
-        if (camera != nullptr)
-        {
-            found_camera = camera;
-            break;
-        }
-    }
+        MG3TR::FrustumCuller::GetInstance().Execute();
+    });
+    graph.AddDependency(culling_job, cameras_job);
+    graph.AddDependency(culling_job, mesh_renderers_job);
 
-    return found_camera;
-}
-
-static std::shared_ptr<MG3TR::Transform> FindTransformWithUID(const std::shared_ptr<MG3TR::Transform> &transform, MG3TR::TUID uid)
-{
-    if (transform->GetUID() == uid)
-    {
-        return transform;
-    }
-
-    std::shared_ptr<MG3TR::Transform> found_transform = nullptr;
-
-    for (auto &child : transform->GetChildren())
-    {
-        auto transf = FindTransformWithUID(child, uid);
-        if (transf != nullptr)
-        {
-            found_transform = transf;
-            break;
-        }
-    }
-
-    return found_transform;
+    return graph;
 }
 
 
@@ -153,15 +100,48 @@ static std::shared_ptr<MG3TR::Transform> FindTransformWithUID(const std::shared_
 namespace MG3TR
 {
     Scene::Scene()
+        : m_root_transform(),
+          m_update_lists(),
+          m_parallel_frame_update_list(),
+          m_cameras(),
+          m_mesh_renderers(),
+          m_submission_graph(CreateSubmissionGraph(m_cameras, m_mesh_renderers)),
+          m_are_update_lists_built(false),
+          m_transforms_by_uid(),
+          m_game_objects_by_uid(),
+          m_components_by_uid(),
+          m_game_objects_by_name(),
+          m_are_lookup_indices_built(false)
     {
         m_root_transform = Transform::Create();
+        m_root_transform->SetScene(this);
     }
 
     Scene::Scene(const std::string &file_name)
+        : m_root_transform(),
+          m_update_lists(),
+          m_parallel_frame_update_list(),
+          m_cameras(),
+          m_mesh_renderers(),
+          m_submission_graph(CreateSubmissionGraph(m_cameras, m_mesh_renderers)),
+          m_are_update_lists_built(false),
+          m_transforms_by_uid(),
+          m_game_objects_by_uid(),
+          m_components_by_uid(),
+          m_game_objects_by_name(),
+          m_are_lookup_indices_built(false)
     {
         LoadFromFile(file_name);
     }
 
+    Scene::~Scene()
+    {
+        if (m_root_transform != nullptr)
+        {
+            m_root_transform->SetScene(nullptr);
+        }
+    }
+
     std::shared_ptr<Transform>& Scene::GetRootTransform()
     {
         return m_root_transform;
@@ -179,10 +159,56 @@ namespace MG3TR
 
     void Scene::Update(const Input &input, const float delta_time)
     {
-        CallParseInput(*m_root_transform, input);
-        CallFrameStart(*m_root_transform, delta_time);
-        CallFrameUpdate(*m_root_transform, delta_time);
-        CallFrameEnd(*m_root_transform, delta_time);
+        // The lists are looked up again before every phase, since the previous one may have changed the scene.
+        for (Component *const component : GetUpdateList(UpdatePhase::ParseInput))
+        {
+            component->ParseInput(input);
+        }
+
+        for (Component *const component : GetUpdateList(UpdatePhase::FrameStart))
+        {
+            component->FrameStart(delta_time);
+        }
+
+        // The thread safe updates may read any transform, so those are refreshed first and kept read only
+        // until every job has finished; the lazy getters would otherwise refresh them from several threads.
+        const std::span<Component *const> parallel_components(GetParallelFrameUpdateList());
+        Transform::SetWorldTransformsReadOnly(true);
+        try
+        {
+            JobSystem::GetInstance().ParallelForEach(parallel_components, UtilsConstants::k_components_per_frame_update_job,
+                                                     [delta_time](Component *const component)
+            {
+                component->FrameUpdate(delta_time);
+            });
+        }
+        catch (...)
+        {
+            Transform::SetWorldTransformsReadOnly(false);
+            throw;
+        }
+        Transform::SetWorldTransformsReadOnly(false);
+
+        for (Component *const component : GetUpdateList(UpdatePhase::FrameUpdate))
+        {
+            component->FrameUpdate(delta_time);
+        }
+
+        Transform::UpdateDirtyWorldTransforms();
+
+        // Waits as late as possible, so that the previous frame is drawn during the earlier phases.
+        RenderQueue::GetInstance().BeginFrame();
+
+        for (Component *const component : GetUpdateList(UpdatePhase::FrameEnd))
+        {
+            component->FrameEnd(delta_time);
+        }
+
+        // FrameEnd may have moved transforms again, and reading dirty ones from several jobs would race.
+        Transform::UpdateDirtyWorldTransforms();
+        RefreshUpdateLists();
+        JobSystem::GetInstance().Run(m_submission_graph);
+        RenderQueue::GetInstance().EndFrame();
     }
     
     void Scene::LoadFromFile(const std::string &file_name)
@@ -194,12 +220,22 @@ namespace MG3TR
         (void)(stream >> json);
         deserialiser.SetJSON(json);
 
+        if (m_root_transform != nullptr)
+        {
+            m_root_transform->SetScene(nullptr);
+        }
+
         m_root_transform = Transform::Create();
+        m_are_update_lists_built = false;
+        m_are_lookup_indices_built = false;
 
+        // Deserialised before joining the scene, which then sees the whole hierarchy at once.
         deserialiser.BeginDeserialisingChild(TransformSerialisationConstants::k_parent_node);
         m_root_transform->Deserialise(deserialiser);
         deserialiser.EndDeserialisingLastChild();
 
+        m_root_transform->SetScene(this);
+
         m_root_transform->LateBind(*this);
 
         /*
@@ -224,13 +260,295 @@ namespace MG3TR
 
     std::shared_ptr<Camera> Scene::FindCameraWithUID(const TUID uid)
     {
-        auto camera = ::FindCameraWithUID(m_root_transform, uid);
+        auto camera = std::dynamic_pointer_cast<Camera>(FindComponentWithUID(uid));
         return camera;
     }
 
     std::shared_ptr<Transform> Scene::FindTransformWithUID(const TUID uid)
     {
-        auto transfrom = ::FindTransformWithUID(m_root_transform, uid);
-        return transfrom;
+        RefreshLookupIndices();
+
+        const auto iterator = m_transforms_by_uid.find(uid);
+        auto transform = (iterator != m_transforms_by_uid.cend()) ? iterator->second.lock() : nullptr;
+        return transform;
+    }
+
+    std::shared_ptr<GameObject> Scene::FindGameObjectWithUID(const TUID uid)
+    {
+        RefreshLookupIndices();
+
+        const auto iterator = m_game_objects_by_uid.find(uid);
+        auto game_object = (iterator != m_game_objects_by_uid.cend()) ? iterator->second.lock() : nullptr;
+        return game_object;
+    }
+
+    std::shared_ptr<Component> Scene::FindComponentWithUID(const TUID uid)
+    {
+        RefreshLookupIndices();
+
+        const auto iterator = m_components_by_uid.find(uid);
+        auto component = (iterator != m_components_by_uid.cend()) ? iterator->second.lock() : nullptr;
+        return component;
+    }
+
+    std::vector<std::shared_ptr<GameObject>> Scene::FindGameObjectsWithName(const std::string &name)
+    {
+        RefreshLookupIndices();
+
+        std::vector<std::shared_ptr<GameObject>> game_objects;
+
+        const auto [begin, end] = m_game_objects_by_name.equal_range(name);
+        for (auto iterator = begin; iterator != end; ++iterator)
+        {
+            auto game_object = iterator->second.lock();
+            if (game_object != nullptr)
+            {
+                game_objects.push_back(std::move(game_object));
+            }
+        }
+
+        return game_objects;
+    }
+
+    void Scene::OnTransformAttached(const std::shared_ptr<Transform> &transform)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            AddToLookupIndices(transform);
+        }
+    }
+
+    void Scene::OnTransformDetached(const std::shared_ptr<Transform> &transform)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            RemoveFromLookupIndices(transform);
+        }
+    }
+
+    void Scene::OnGameObjectAttached(const std::shared_ptr<GameObject> &game_object)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            AddToLookupIndices(game_object);
+        }
+    }
+
+    void Scene::OnGameObjectDetached(const std::shared_ptr<GameObject> &game_object)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            RemoveFromLookupIndices(game_object);
+        }
+    }
+
+    void Scene::OnComponentAttached(const std::shared_ptr<Component> &component)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            (void)m_components_by_uid.emplace(component->GetUID(), component);
+        }
+    }
+
+    void Scene::OnComponentDetached(const std::shared_ptr<Component> &component)
+    {
+        m_are_update_lists_built = false;
+
+        if (m_are_lookup_indices_built)
+        {
+            EraseLookupEntry(m_components_by_uid, component->GetUID(), component);
+        }
+    }
+
+    void Scene::OnGameObjectRenamed(const std::shared_ptr<GameObject> &game_object, const std::string &previous_name)
+    {
+        if (m_are_lookup_indices_built)
+        {
+            EraseLookupEntry(m_game_objects_by_name, previous_name, game_object);
+            (void)m_game_objects_by_name.emplace(game_object->GetName(), game_object);
+        }
+    }
+
+    void Scene::OnComponentUIDChanged(const Component &component, const TUID previous_uid)
+    {
+        if (!m_are_lookup_indices_built)
+        {
+            return;
+        }
+
+        // Only the component itself is known here, so its entry is found by address.
+        const auto [begin, end] = m_components_by_uid.equal_range(previous_uid);
+        for (auto iterator = begin; iterator != end; ++iterator)
+        {
+            if (iterator->second.lock().get() == &component)
+            {
+                const std::weak_ptr<Component> entry = iterator->second;
+
+                (void)m_components_by_uid.erase(iterator);
+                (void)m_components_by_uid.emplace(component.GetUID(), entry);
+                return;
+            }
+        }
+    }
+
+    void Scene::RefreshUpdateLists()
+    {
+        if (m_are_update_lists_built)
+        {
+            return;
+        }
+
+        for (auto &update_list : m_update_lists)
+        {
+            update_list.clear();
+        }
+        m_parallel_frame_update_list.clear();
+        m_cameras.clear();
+        m_mesh_renderers.clear();
+
+        AddToUpdateLists(*m_root_transform);
+
+        std::sort(m_cameras.begin(), m_cameras.end());
+        std::sort(m_mesh_renderers.begin(), m_mesh_renderers.end());
+
+        m_are_update_lists_built = true;
+    }
+
+    void Scene::AddToUpdateLists(Transform &transform)
+    {
+        const auto &game_object = transform.GetGameObject();
+        if (game_object != nullptr)
+        {
+            for (const auto &component : game_object->GetComponents())
+            {
+                const TUpdatePhaseMask phases = component->GetUpdatePhases();
+
+                for (std::size_t i = 0; i < k_update_phase_count; ++i)
+                {
+                    const auto phase = static_cast<UpdatePhase>(i);
+                    if ((phases & GetUpdatePhaseBit(phase)) == 0U)
+                    {
+                        continue;
+                    }
+
+                    const bool is_parallel = (phase == UpdatePhase::FrameUpdate) && component->IsFrameUpdateThreadSafe();
+                    auto &update_list = is_parallel ? m_parallel_frame_update_list : m_update_lists[i];
+
+                    update_list.push_back(component.get());
+                }
+
+                auto *const camera = dynamic_cast<Camera*>(component.get());
+                if (camera != nullptr)
+                {
+                    m_cameras.push_back(camera);
+                }
+
+                auto *const mesh_renderer = dynamic_cast<MeshRenderer*>(component.get());
+                if (mesh_renderer != nullptr)
+                {
+                    m_mesh_renderers.push_back(mesh_renderer);
+                }
+            }
+        }
+
+        for (const auto &child : transform.GetChildren())
+        {
+            AddToUpdateLists(*child);
+        }
+    }
+
+    const std::vector<Component*>& Scene::GetUpdateList(const UpdatePhase phase)
+    {
+        RefreshUpdateLists();
+
+        const auto &update_list = m_update_lists[static_cast<std::size_t>(phase)];
+        return update_list;
+    }
+
+    const std::vector<Component*>& Scene::GetParallelFrameUpdateList()
+    {
+        RefreshUpdateLists();
+        return m_parallel_frame_update_list;
+    }
+
+    void Scene::RefreshLookupIndices()
+    {
+        if (m_are_lookup_indices_built)
+        {
+            return;
+        }
+
+        m_transforms_by_uid.clear();
+        m_game_objects_by_uid.clear();
+        m_components_by_uid.clear();
+        m_game_objects_by_name.clear();
+
+        AddToLookupIndices(m_root_transform);
+
+        m_are_lookup_indices_built = true;
+    }
+
+    void Scene::AddToLookupIndices(const std::shared_ptr<Transform> &transform)
+    {
+        (void)m_transforms_by_uid.emplace(transform->GetUID(), transform);
+
+        const auto game_object = transform->GetGameObject();
+        if (game_object != nullptr)
+        {
+            AddToLookupIndices(game_object);
+        }
+
+        for (const auto &child : transform->GetChildren())
+        {
+            AddToLookupIndices(child);
+        }
+    }
+
+    void Scene::RemoveFromLookupIndices(const std::shared_ptr<Transform> &transform)
+    {
+        EraseLookupEntry(m_transforms_by_uid, transform->GetUID(), transform);
+
+        const auto game_object = transform->GetGameObject();
+        if (game_object != nullptr)
+        {
+            RemoveFromLookupIndices(game_object);
+        }
+
+        for (const auto &child : transform->GetChildren())
+        {
+            RemoveFromLookupIndices(child);
+        }
+    }
+
+    void Scene::AddToLookupIndices(const std::shared_ptr<GameObject> &game_object)
+    {
+        (void)m_game_objects_by_uid.emplace(game_object->GetUID(), game_object);
+        (void)m_game_objects_by_name.emplace(game_object->GetName(), game_object);
+
+        for (const auto &component : game_object->GetComponents())
+        {
+            (void)m_components_by_uid.emplace(component->GetUID(), component);
+        }
+    }
+
+    void Scene::RemoveFromLookupIndices(const std::shared_ptr<GameObject> &game_object)
+    {
+        EraseLookupEntry(m_game_objects_by_uid, game_object->GetUID(), game_object);
+        EraseLookupEntry(m_game_objects_by_name, game_object->GetName(), game_object);
+
+        for (const auto &component : game_object->GetComponents())
+        {
+            EraseLookupEntry(m_components_by_uid, component->GetUID(), component);
+        }
     }
 }
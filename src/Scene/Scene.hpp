@@ -1,16 +1,25 @@
 #ifndef MG3TR_SRC_SCENE_SCENE_HPP_INCLUDED
 #define MG3TR_SRC_SCENE_SCENE_HPP_INCLUDED
 
+#include <Components/UpdatePhase.hpp>
+#include <Utils/JobSystem.hpp>
 #include <Utils/TUID.hpp>
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace MG3TR
 {
     class Camera;
+    class Component;
+    class GameObject;
     class Input;
+    class MeshRenderer;
     class Transform;
 
     class Scene
@@ -18,16 +27,39 @@ namespace MG3TR
     private:
         std::shared_ptr<Transform> m_root_transform;
 
+        // Components in hierarchy order, listed only under the phases they take part in. Rebuilt when
+        // transforms, game objects or components are attached to or detached from the scene, which the
+        // scene is told about by them. Changes made directly through Transform::GetChildren or
+        // GameObject::GetComponents are not seen.
+        std::array<std::vector<Component*>, k_update_phase_count> m_update_lists;
+        // Left out of the FrameUpdate list.
+        std::vector<Component*> m_parallel_frame_update_list;
+        // Rebuilt with the update lists, in address order.
+        std::vector<Camera*> m_cameras;
+        std::vector<MeshRenderer*> m_mesh_renderers;
+        // Submits the cameras and mesh renderers of the frame, and culls them.
+        JobGraph m_submission_graph;
+        bool m_are_update_lists_built;
+
+        // Built on the first lookup, then kept up to date by the same calls as the update lists, and on
+        // renames and UID changes. Where UIDs repeat, any of the objects with the UID may be found.
+        std::unordered_multimap<TUID, std::weak_ptr<Transform>> m_transforms_by_uid;
+        std::unordered_multimap<TUID, std::weak_ptr<GameObject>> m_game_objects_by_uid;
+        std::unordered_multimap<TUID, std::weak_ptr<Component>> m_components_by_uid;
+        std::unordered_multimap<std::string, std::weak_ptr<GameObject>> m_game_objects_by_name;
+        bool m_are_lookup_indices_built;
+
     public:
         Scene();
         Scene(const std::string &file_name);
-        virtual ~Scene() = default;
+        virtual ~Scene();
 
+        // The submission graph refers to the lists of the scene.
         Scene(const Scene &) = delete;
-        Scene(Scene &&) = default;
+        Scene(Scene &&) = delete;
         
         Scene& operator=(const Scene &) = delete;
-        Scene& operator=(Scene &&) = default;
+        Scene& operator=(Scene &&) = delete;
 
         std::shared_ptr<Transform>& GetRootTransform();
         const std::shared_ptr<Transform>& GetRootTransform() const;
@@ -37,8 +69,36 @@ namespace MG3TR
         void LoadFromFile(const std::string &file_name);
         void SaveToFile(const std::string &file_name) const;
 
+        // Return nullptr when nothing in the scene has the UID.
         std::shared_ptr<Camera> FindCameraWithUID(const TUID uid);
         std::shared_ptr<Transform> FindTransformWithUID(const TUID uid);
+        std::shared_ptr<GameObject> FindGameObjectWithUID(const TUID uid);
+        std::shared_ptr<Component> FindComponentWithUID(const TUID uid);
+
+        std::vector<std::shared_ptr<GameObject>> FindGameObjectsWithName(const std::string &name);
+
+        // Called by the transforms and game objects of the scene. An attached transform brings its
+        // children, game objects and components along, and a detached one takes them away.
+        void OnTransformAttached(const std::shared_ptr<Transform> &transform);
+        void OnTransformDetached(const std::shared_ptr<Transform> &transform);
+        void OnGameObjectAttached(const std::shared_ptr<GameObject> &game_object);
+        void OnGameObjectDetached(const std::shared_ptr<GameObject> &game_object);
+        void OnComponentAttached(const std::shared_ptr<Component> &component);
+        void OnComponentDetached(const std::shared_ptr<Component> &component);
+        void OnGameObjectRenamed(const std::shared_ptr<GameObject> &game_object, const std::string &previous_name);
+        void OnComponentUIDChanged(const Component &component, const TUID previous_uid);
+
+    private:
+        void RefreshUpdateLists();
+        void AddToUpdateLists(Transform &transform);
+        const std::vector<Component*>& GetUpdateList(const UpdatePhase phase);
+        const std::vector<Component*>& GetParallelFrameUpdateList();
+
+        void RefreshLookupIndices();
+        void AddToLookupIndices(const std::shared_ptr<Transform> &transform);
+        void RemoveFromLookupIndices(const std::shared_ptr<Transform> &transform);
+        void AddToLookupIndices(const std::shared_ptr<GameObject> &game_object);
+        void RemoveFromLookupIndices(const std::shared_ptr<GameObject> &game_object);
     };
 }
 
@@ -2,12 +2,14 @@
 
 #include <Constants/ComponentConstants.hpp>
 #include <Constants/SerialisationConstants.hpp>
+#include <Scene/Scene.hpp>
 #include <Serialisation/IDeserialiser.hpp>
 #include <Serialisation/ISerialiser.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 #include <Utils/TryCathRethrowStacktrace.hpp>
 
 #include <format>
+#include <utility>
 
 namespace MG3TR
 {
@@ -36,6 +38,11 @@ namespace MG3TR
         return are_not_equal;
     }
 
+    TUID GameObject::GetUID() const
+    {
+        return m_uid;
+    }
+
     const std::string& GameObject::GetName() const
     {
         return m_name;
@@ -43,7 +50,13 @@ namespace MG3TR
 
     void GameObject::SetName(const std::string &name)
     {
-        m_name = name;
+        const std::string previous_name = std::exchange(m_name, name);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnGameObjectRenamed(shared_from_this(), previous_name);
+        }
     }
 
     std::weak_ptr<Transform> GameObject::GetTransform() const
@@ -56,6 +69,13 @@ namespace MG3TR
         m_transform = transform;
     }
 
+    Scene* GameObject::GetScene() const
+    {
+        const auto transform = m_transform.lock();
+        Scene *const scene = (transform != nullptr) ? transform->GetScene() : nullptr;
+        return scene;
+    }
+
     std::vector<std::shared_ptr<Component>>& GameObject::GetComponents()
     {
         return m_components;
@@ -76,6 +96,12 @@ namespace MG3TR
                                           " has already been added previously.");
         }
         m_components.push_back(component);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnComponentAttached(component);
+        }
     }
     
     void GameObject::AddComponent(const std::shared_ptr<Component> &component, const std::size_t position)
@@ -96,7 +122,13 @@ namespace MG3TR
             throw ExceptionWithStacktrace(error);
         }
 
-        (void)m_components.insert(m_components.begin() + position, std::move(component));
+        (void)m_components.insert(m_components.begin() + position, component);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnComponentAttached(component);
+        }
     }
 
     void GameObject::RemoveComponent(const std::shared_ptr<Component> &component)
@@ -108,6 +140,12 @@ namespace MG3TR
             throw ExceptionWithStacktrace("Could not find component to remove.");
         }
         (void)m_components.erase(component_in_vector_iterator);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnComponentDetached(component);
+        }
     }
     
     void GameObject::RemoveComponent(std::size_t position)
@@ -119,7 +157,14 @@ namespace MG3TR
                                                   position, components_size);
             throw ExceptionWithStacktrace(error);
         }
+        const auto component = m_components[position];
         (void)m_components.erase(m_components.begin() + position);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnComponentDetached(component);
+        }
     }
 
     void GameObject::Serialise(ISerialiser &serialiser)
@@ -39,12 +39,17 @@ namespace MG3TR
         bool operator==(const GameObject &other) const;
         bool operator!=(const GameObject &other) const;
 
+        TUID GetUID() const;
+
         const std::string& GetName() const;
         void SetName(const std::string &name);
 
         std::weak_ptr<Transform> GetTransform() const;
         void SetTransform(const std::shared_ptr<Transform> &transform);
 
+        // The scene of the transform, or nullptr when it is not part of a scene.
+        Scene* GetScene() const;
+
         std::vector<std::shared_ptr<Component>>& GetComponents();
         const std::vector<std::shared_ptr<Component>>& GetComponents() const;
 
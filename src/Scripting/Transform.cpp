@@ -3,22 +3,29 @@
 #include <Constants/SerialisationConstants.hpp>
 #include <Constants/MathConstants.hpp>
 #include <Math/Vector4.hpp>
+#include <Scene/Scene.hpp>
 #include <Scripting/GameObject.hpp>
 #include <Serialisation/IDeserialiser.hpp>
 #include <Serialisation/ISerialiser.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
+#include <algorithm>
+
 namespace MG3TR
 {
     Transform::Transform()
-        : m_local_position(Vector3Constants::k_zero),
-          m_local_rotation(QuaternionConstants::k_identity),
-          m_local_scale(Vector3Constants::k_one),
+        : m_handle(TransformHierarchy::GetInstance().Create()),
           m_parent(),
           m_game_object(nullptr),
+          m_scene(nullptr),
           m_uid(s_uid_generator.GetNextUID())
     {
-        UpdateLocalToWorldAndWorldToLocalVariables();
+
+    }
+
+    Transform::~Transform()
+    {
+        TransformHierarchy::GetInstance().Destroy(m_handle);
     }
 
     [[nodiscard]] std::shared_ptr<Transform> Transform::Create()
@@ -41,41 +48,40 @@ namespace MG3TR
 
     Vector3 Transform::GetLocalPosition() const
     {
-        return m_local_position;
+        return TransformHierarchy::GetInstance().GetLocalPosition(m_handle);
     }
 
     void Transform::SetLocalPosition(const Vector3 &local_position)
     {
-        m_local_position = local_position;
-        UpdateLocalToWorldAndWorldToLocalVariablesForChildren();
+        TransformHierarchy::GetInstance().SetLocalPosition(m_handle, local_position);
     }
 
     Quaternion Transform::GetLocalRotation() const
     {
-        return m_local_rotation;
+        return TransformHierarchy::GetInstance().GetLocalRotation(m_handle);
     }
     
     void Transform::SetLocalRotation(const Quaternion &local_rotation)
     {
-        m_local_rotation = local_rotation;
-        UpdateLocalToWorldAndWorldToLocalVariablesForChildren();
+        TransformHierarchy::GetInstance().SetLocalRotation(m_handle, local_rotation);
     }
 
     Vector3 Transform::GetLocalScale() const
     {
-        return m_local_scale;
+        return TransformHierarchy::GetInstance().GetLocalScale(m_handle);
     }
     
     void Transform::SetLocalScale(const Vector3 &local_scale)
     {
-        m_local_scale = local_scale;
-        UpdateLocalToWorldAndWorldToLocalVariablesForChildren();
+        TransformHierarchy::GetInstance().SetLocalScale(m_handle, local_scale);
     }
 
     Vector3 Transform::GetWorldPosition() const
     {
-        Vector4 position(m_local_position, 1.0F);
-        position = m_local_to_world_model_matrix * position;
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
+        Vector4 position(GetLocalPosition(), 1.0F);
+        position = hierarchy.GetParentWorldMatrix(m_handle) * position;
         const Vector3 world_position(position.x(), position.y(), position.z());
 
         return world_position;
@@ -83,33 +89,43 @@ namespace MG3TR
 
     void Transform::SetWorldPosition(const Vector3 &world_position)
     {
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
         Vector4 position(world_position, 1.0F);
-        position = m_world_to_local_model_matrix * position;
+        position = hierarchy.GetInverseParentWorldMatrix(m_handle) * position;
         const Vector3 local_position(position.x(), position.y(), position.z());
         SetLocalPosition(local_position);
     }
     
     Quaternion Transform::GetWorldRotation() const
     {
-        const auto world_rotation = m_local_to_world_rotation * m_local_rotation;
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
+        const auto world_rotation = hierarchy.GetParentWorldRotation(m_handle) * GetLocalRotation();
         return world_rotation;
     }
 
     void Transform::SetWorldRotation(const Quaternion &world_rotation)
     {
-        const auto local_rotation = world_rotation * m_world_to_local_rotation;
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
+        const auto local_rotation = world_rotation * hierarchy.GetInverseParentWorldRotation(m_handle);
         SetLocalRotation(local_rotation);
     }
     
     Vector3 Transform::GetWorldScale() const
     {
-        const auto world_scale = Vector3::Scale(m_local_to_world_scale, m_local_scale);
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
+        const auto world_scale = Vector3::Scale(hierarchy.GetParentWorldScale(m_handle), GetLocalScale());
         return world_scale;
     }
 
     void Transform::SetWorldScale(const Vector3 &world_scale)
     {
-        const auto local_scale = Vector3::Scale(m_world_to_local_scale, world_scale);
+        auto& hierarchy = TransformHierarchy::GetInstance();
+
+        const auto local_scale = Vector3::Scale(hierarchy.GetInverseParentWorldScale(m_handle), world_scale);
         SetLocalScale(local_scale);
     }
     
@@ -133,40 +149,27 @@ namespace MG3TR
 
     Matrix4x4 Transform::GetLocalToWorldMatrix() const
     {
-        return m_local_to_world_model_matrix;
+        return TransformHierarchy::GetInstance().GetParentWorldMatrix(m_handle);
     }
 
     Matrix4x4 Transform::GetWorldToLocalMatrix() const
     {
-        return m_world_to_local_model_matrix;
+        return TransformHierarchy::GetInstance().GetInverseParentWorldMatrix(m_handle);
     }
 
     Matrix4x4 Transform::GetLocalModelMatrix() const
     {
-        const auto local_position = GetLocalPosition();
-        const auto local_rotation = GetLocalRotation();
-        const auto local_scale = GetLocalScale();
-
-        auto mat = Matrix4x4(1.0F);
-        (void)mat.Translate(local_position);
-        (void)mat.Rotate(local_rotation);
-        (void)mat.Scale(local_scale);
-
-        return mat;
+        return TransformHierarchy::GetInstance().GetLocalModelMatrix(m_handle);
     }
 
     Matrix4x4 Transform::GetWorldModelMatrix() const
     {
-        const auto world_position = GetWorldPosition();
-        const auto world_rotation = GetWorldRotation();
-        const auto world_scale = GetWorldScale();
-
-        auto mat = Matrix4x4(1.0F);
-        (void)mat.Translate(world_position);
-        (void)mat.Rotate(world_rotation);
-        (void)mat.Scale(world_scale);
+        return TransformHierarchy::GetInstance().GetWorldMatrix(m_handle);
+    }
 
-        return mat;
+    std::uint32_t Transform::GetWorldVersion() const
+    {
+        return TransformHierarchy::GetInstance().GetWorldVersion(m_handle);
     }
 
     Vector3 Transform::TransformPointToWorldSpace(const Vector3 &point) const
@@ -181,7 +184,7 @@ namespace MG3TR
     Vector3 Transform::TransformPointToLocalSpace(const Vector3 &point) const
     {
         Vector4 position(point, 1.0F);
-        position = Matrix4x4::Inverse(GetWorldModelMatrix()) * position;
+        position = Matrix4x4::InverseTRS(GetWorldModelMatrix()) * position;
         const  Vector3 local_space_position(position.x(), position.y(), position.z());
 
         return local_space_position;
@@ -206,7 +209,9 @@ namespace MG3TR
             parent.lock()->AddChild(shared_from_this());
         }
 
-        UpdateLocalToWorldAndWorldToLocalVariables();
+        const auto new_parent = parent.lock();
+        const TTransformHandle parent_handle = (new_parent != nullptr) ? new_parent->m_handle : k_invalid_transform_handle;
+        TransformHierarchy::GetInstance().SetParent(m_handle, parent_handle);
     }
 
     std::vector<std::shared_ptr<Transform>>& Transform::GetChildren()
@@ -226,7 +231,21 @@ namespace MG3TR
 
     void Transform::SetGameObject(const std::shared_ptr<GameObject> &game_object)
     {
+        const auto previous_game_object = m_game_object;
         m_game_object = game_object;
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            if (previous_game_object != nullptr)
+            {
+                scene->OnGameObjectDetached(previous_game_object);
+            }
+            if (game_object != nullptr)
+            {
+                scene->OnGameObjectAttached(game_object);
+            }
+        }
     }
 
     TUID Transform::GetUID() const
@@ -234,6 +253,23 @@ namespace MG3TR
         return m_uid;
     }
 
+    Scene* Transform::GetScene() const
+    {
+        Scene *scene = m_scene;
+
+        for (auto parent = m_parent.lock(); parent != nullptr; parent = parent->m_parent.lock())
+        {
+            scene = parent->m_scene;
+        }
+
+        return scene;
+    }
+
+    void Transform::SetScene(Scene *scene)
+    {
+        m_scene = scene;
+    }
+
     void Transform::AddChild(const std::shared_ptr<Transform> &child)
     {
         const auto child_already_in_children_iterator = std::find(m_children.cbegin(), m_children.cend(), child);
@@ -246,6 +282,12 @@ namespace MG3TR
         }
 
         m_children.push_back(child);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnTransformAttached(child);
+        }
     }
     
     void Transform::AddChild(const std::shared_ptr<Transform> &child, const std::size_t position)
@@ -267,6 +309,12 @@ namespace MG3TR
         }
 
         (void)m_children.insert(m_children.begin() + position, child);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnTransformAttached(child);
+        }
     }
 
     void Transform::RemoveChild(const std::shared_ptr<Transform> &child)
@@ -280,6 +328,12 @@ namespace MG3TR
         }
 
         (void)m_children.erase(child_already_in_children_iterator);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnTransformDetached(child);
+        }
     }
 
     void Transform::RemoveChild(const std::size_t position)
@@ -291,7 +345,14 @@ namespace MG3TR
                                                    position, children_size);
             throw ExceptionWithStacktrace(string);
         }
+        const auto child = m_children[position];
         (void)m_children.erase(m_children.begin() + position);
+
+        Scene *const scene = GetScene();
+        if (scene != nullptr)
+        {
+            scene->OnTransformDetached(child);
+        }
     }
 
     void Transform::Serialise(ISerialiser &serialiser)
@@ -299,9 +360,9 @@ namespace MG3TR
         namespace Constants = TransformSerialisationConstants;
 
         serialiser.SerialiseUnsigned(Constants::k_uid_attribute, m_uid);
-        serialiser.SerialiseVector3(Constants::k_local_position_attribute, m_local_position);
-        serialiser.SerialiseQuaternion(Constants::k_local_rotation_attribute, m_local_rotation);
-        serialiser.SerialiseVector3(Constants::k_local_scale_attribute, m_local_scale);
+        serialiser.SerialiseVector3(Constants::k_local_position_attribute, GetLocalPosition());
+        serialiser.SerialiseQuaternion(Constants::k_local_rotation_attribute, GetLocalRotation());
+        serialiser.SerialiseVector3(Constants::k_local_scale_attribute, GetLocalScale());
 
         const std::size_t child_count = m_children.size();
 
@@ -335,9 +396,9 @@ namespace MG3TR
         namespace Constants = TransformSerialisationConstants;
 
         m_uid = deserialiser.DeserialiseUnsigned(Constants::k_uid_attribute);
-        m_local_position = deserialiser.DeserialiseVector3(Constants::k_local_position_attribute);
-        m_local_rotation = deserialiser.DeserialiseQuaternion(Constants::k_local_rotation_attribute);
-        m_local_scale = deserialiser.DeserialiseVector3(Constants::k_local_scale_attribute);
+        SetLocalPosition(deserialiser.DeserialiseVector3(Constants::k_local_position_attribute));
+        SetLocalRotation(deserialiser.DeserialiseQuaternion(Constants::k_local_rotation_attribute));
+        SetLocalScale(deserialiser.DeserialiseVector3(Constants::k_local_scale_attribute));
 
         const bool has_children = deserialiser.ContainsField(Constants::k_children_attribute);
         if (has_children)
@@ -383,120 +444,13 @@ namespace MG3TR
         }
     }
 
-    Matrix4x4 Transform::CalculateLocalToWorldModelMatrix() const
+    void Transform::UpdateDirtyWorldTransforms()
     {
-        Matrix4x4 local_matrix(1.0F);
-        auto parent = m_parent;
-
-        while (parent.lock() != nullptr)
-        {
-            const Matrix4x4 parent_local_matrix = parent.lock()->GetLocalModelMatrix();
-            local_matrix = parent_local_matrix * local_matrix;
-            parent = parent.lock()->m_parent;
-        }
-
-        return local_matrix;
-    }
-
-    Matrix4x4 Transform::CalculateWorldToLocalModelMatrix() const
-    {
-        const auto local_to_world = CalculateLocalToWorldModelMatrix();
-        const auto inverse = Matrix4x4::Inverse(local_to_world);
-
-        return inverse;
-    }
-
-    Matrix4x4 Transform::CalculateWorldToLocalModelMatrix(const Matrix4x4 &local_to_world) const
-    {
-        const auto inverse = Matrix4x4::Inverse(local_to_world);
-        return inverse;
-    }
-    
-    Quaternion Transform::CalculateLocalToWorldRotation() const
-    {
-        Quaternion q = QuaternionConstants::k_identity;
-        
-        auto parent = m_parent;
-
-        while (parent.lock() != nullptr)
-        {
-            const Quaternion parent_rotation = parent.lock()->GetLocalRotation();
-            q *= parent_rotation;
-            parent = parent.lock()->m_parent;
-        }
-
-        return q;
-    }
-    
-    Quaternion Transform::CalculateWorldToLocalRotation() const
-    {
-        const auto local_to_world = CalculateLocalToWorldRotation();
-        const auto inverse = Quaternion::Inverse(local_to_world);
-        return inverse;
+        TransformHierarchy::GetInstance().UpdateWorldTransforms();
     }
 
-    Quaternion Transform::CalculateWorldToLocalRotation(const Quaternion &local_rotation) const
+    void Transform::SetWorldTransformsReadOnly(const bool is_read_only)
     {
-        const auto inverse = Quaternion::Inverse(local_rotation);
-        return inverse;
-    }
-    
-    Vector3 Transform::CalculateLocalToWorldScale() const
-    {
-        Vector3 scale = Vector3Constants::k_one;
-
-        auto parent = m_parent;
-
-        while (parent.lock() != nullptr)
-        {
-            const Vector3 parent_scale = parent.lock()->GetLocalScale();
-            scale.Scale(parent_scale);
-            parent = parent.lock()->m_parent;
-        }
-
-        return scale;
-    }
-    
-    Vector3 Transform::CalculateWorldToLocalScale() const
-    {
-        const Vector3 scale = CalculateLocalToWorldScale();
-        const Vector3 inverse(1.0F / scale.x(), 1.0F / scale.y(), 1.0F / scale.z());
-
-        return inverse;
-    }
-
-    Vector3 Transform::CalculateWorldToLocalScale(const Vector3 &local_scale) const
-    {
-        const Vector3 inverse(1.0F / local_scale.x(), 1.0F / local_scale.y(), 1.0F / local_scale.z());
-        return inverse;
-    }
-
-    void Transform::UpdateLocalToWorldAndWorldToLocalVariables()
-    {
-        m_local_to_world_model_matrix = CalculateLocalToWorldModelMatrix();
-        m_world_to_local_model_matrix = CalculateWorldToLocalModelMatrix(m_local_to_world_model_matrix);
-
-        m_local_to_world_rotation = CalculateLocalToWorldRotation();
-        m_world_to_local_rotation = CalculateWorldToLocalRotation(m_local_to_world_rotation);
-
-        m_local_to_world_scale = CalculateLocalToWorldScale();
-        m_world_to_local_scale = CalculateWorldToLocalScale(m_local_to_world_scale);
-    }
-
-    void Transform::UpdateLocalToWorldAndWorldToLocalVariablesForChildren()
-    {
-        for (auto &child : m_children)
-        {
-            child->m_local_to_world_model_matrix = m_local_to_world_model_matrix * GetLocalModelMatrix();
-            child->m_world_to_local_model_matrix = CalculateWorldToLocalModelMatrix(child->m_local_to_world_model_matrix);
-
-            child->m_local_to_world_rotation = m_local_to_world_rotation * GetLocalRotation();
-            child->m_world_to_local_rotation = CalculateWorldToLocalRotation(child->m_local_to_world_rotation);
-
-            child->m_local_to_world_scale = Vector3::Scale(m_local_to_world_scale, GetLocalScale());
-            child->m_world_to_local_scale = CalculateWorldToLocalScale(child->m_local_to_world_scale);
-
-            child->UpdateLocalToWorldAndWorldToLocalVariablesForChildren();
-        }
+        TransformHierarchy::GetInstance().SetReadOnly(is_read_only);
     }
 }
@@ -5,37 +5,32 @@
 #include <Math/Quaternion.hpp>
 #include <Math/Vector3.hpp>
 #include <Scene/ILateBindable.hpp>
+#include <Scripting/TransformHierarchy.hpp>
 #include <Serialisation/ISerialisable.hpp>
 #include <Utils/UIDGenerator.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace MG3TR
 {
     class GameObject;
+    class Scene;
 
     class Transform : public std::enable_shared_from_this<Transform>, public ISerialisable, public ILateBindable
     {
     private:
-        Vector3 m_local_position;
-        Quaternion m_local_rotation;
-        Vector3 m_local_scale;
-
-        Matrix4x4 m_local_to_world_model_matrix;
-        Matrix4x4 m_world_to_local_model_matrix;
-
-        Quaternion m_local_to_world_rotation;
-        Quaternion m_world_to_local_rotation;
-
-        Vector3 m_local_to_world_scale;
-        Vector3 m_world_to_local_scale;
+        // The transform data lives in TransformHierarchy.
+        TTransformHandle m_handle;
 
         std::weak_ptr<Transform> m_parent;
         std::vector<std::shared_ptr<Transform>> m_children;
 
         std::shared_ptr<GameObject> m_game_object;
+        // Only set on the root transform of a scene.
+        Scene *m_scene;
 
         static inline UIDGenerator s_uid_generator;
         TUID m_uid;
@@ -44,7 +39,7 @@ namespace MG3TR
 
     public:
         [[nodiscard]] static std::shared_ptr<Transform> Create();
-        virtual ~Transform() = default;
+        virtual ~Transform();
     
         Transform(const Transform &) = delete;
         Transform(Transform &&) = delete;
@@ -82,6 +77,8 @@ namespace MG3TR
 
         Matrix4x4 GetLocalModelMatrix() const;
         Matrix4x4 GetWorldModelMatrix() const;
+        // See TransformHierarchy::GetWorldVersion.
+        std::uint32_t GetWorldVersion() const;
 
         Vector3 TransformPointToWorldSpace(const Vector3 &point) const;
         Vector3 TransformPointToLocalSpace(const Vector3 &point) const;
@@ -97,6 +94,11 @@ namespace MG3TR
 
         TUID GetUID() const;
 
+        // The scene of the root of this transform, or nullptr when it is not part of a scene.
+        Scene* GetScene() const;
+        // Called by the scene on its root transform.
+        void SetScene(Scene *scene);
+
         void AddChild(const std::shared_ptr<Transform> &child);
         void AddChild(const std::shared_ptr<Transform> &child, const std::size_t position);
 
@@ -107,21 +109,13 @@ namespace MG3TR
         virtual void Deserialise(IDeserialiser &deserialiser) override;
         virtual void LateBind(Scene &scene) override;
 
-    private:
-        Matrix4x4 CalculateLocalToWorldModelMatrix() const;
-        Matrix4x4 CalculateWorldToLocalModelMatrix() const;
-        Matrix4x4 CalculateWorldToLocalModelMatrix(const Matrix4x4 &local_to_world) const;
-
-        Quaternion CalculateLocalToWorldRotation() const;
-        Quaternion CalculateWorldToLocalRotation() const;
-        Quaternion CalculateWorldToLocalRotation(const Quaternion &local_rotation) const;
-
-        Vector3 CalculateLocalToWorldScale() const;
-        Vector3 CalculateWorldToLocalScale() const;
-        Vector3 CalculateWorldToLocalScale(const Vector3 &local_scale) const;
+        // Refreshes, parents first, every transform invalidated since the previous call. Getters
+        // stay correct without it; it only moves the work out of the render loop.
+        static void UpdateDirtyWorldTransforms();
 
-        void UpdateLocalToWorldAndWorldToLocalVariables();
-        void UpdateLocalToWorldAndWorldToLocalVariablesForChildren();
+        // While read only, every transform is refreshed and may be read from several threads at once,
+        // and any change throws.
+        static void SetWorldTransformsReadOnly(const bool is_read_only);
     };
 }
 
@@ -0,0 +1,608 @@
+#include "TransformHierarchy.hpp"
+
+#include <Constants/MathConstants.hpp>
+#include <Constants/UtilsConstants.hpp>
+#include <Math/Vector4.hpp>
+#include <Utils/ExceptionWithStacktrace.hpp>
+#include <Utils/JobSystem.hpp>
+
+#include <algorithm>
+#include <utility>
+
+// Reorders the values so that the one at old_slots[i] ends up at i.
+template <typename TValue>
+static void PermuteSlots(std::vector<TValue> &values, const std::vector<std::uint32_t> &old_slots)
+{
+    std::vector<TValue> permuted;
+    permuted.reserve(old_slots.size());
+
+    for (const auto old_slot : old_slots)
+    {
+        permuted.push_back(std::move(values[old_slot]));
+    }
+
+    values = std::move(permuted);
+}
+
+namespace MG3TR
+{
+    TransformHierarchy TransformHierarchy::m_instance;
+
+    TransformHierarchy::TransformHierarchy()
+        : m_first_dirty_slot(0),
+          m_is_order_dirty(false),
+          m_level_offsets{ 0 },
+          m_are_levels_dirty(false),
+          m_is_read_only(false)
+    {
+
+    }
+
+    TransformHierarchy& TransformHierarchy::GetInstance()
+    {
+        return m_instance;
+    }
+
+    TTransformHandle TransformHierarchy::Create()
+    {
+        ThrowIfReadOnly();
+
+        TTransformHandle handle = k_invalid_transform_handle;
+
+        if (!m_free_handles.empty())
+        {
+            handle = m_free_handles.back();
+            m_free_handles.pop_back();
+        }
+        else
+        {
+            handle = static_cast<TTransformHandle>(m_slot_of_handle.size());
+
+            m_slot_of_handle.push_back(k_invalid_slot);
+            m_parents.push_back(k_invalid_transform_handle);
+            m_first_children.push_back(k_invalid_transform_handle);
+            m_next_siblings.push_back(k_invalid_transform_handle);
+            m_world_versions.push_back(0U);
+        }
+
+        // New transforms are roots, so appending them keeps parents before children.
+        const auto slot = static_cast<TSlot>(m_handle_of_slot.size());
+
+        m_handle_of_slot.push_back(handle);
+        m_parent_slots.push_back(k_invalid_slot);
+        m_local_positions.push_back(Vector3Constants::k_zero);
+        m_local_rotations.push_back(QuaternionConstants::k_identity);
+        m_local_scales.push_back(Vector3Constants::k_one);
+        m_parent_world_matrices.push_back(Matrix4x4(1.0F));
+        m_parent_world_rotations.push_back(QuaternionConstants::k_identity);
+        m_parent_world_scales.push_back(Vector3Constants::k_one);
+        m_world_matrices.push_back(Matrix4x4(1.0F));
+        m_inverse_parent_world_matrices.push_back(Matrix4x4(1.0F));
+        m_inverse_parent_world_rotations.push_back(QuaternionConstants::k_identity);
+        m_inverse_parent_world_scales.push_back(Vector3Constants::k_one);
+        m_is_world_dirty.push_back(1U);
+        m_are_inverses_dirty.push_back(1U);
+
+        m_slot_of_handle[handle] = slot;
+        m_parents[handle] = k_invalid_transform_handle;
+        m_first_children[handle] = k_invalid_transform_handle;
+        m_next_siblings[handle] = k_invalid_transform_handle;
+        ++m_world_versions[handle];
+
+        m_first_dirty_slot = std::min(m_first_dirty_slot, slot);
+        m_are_levels_dirty = true;
+
+        return handle;
+    }
+
+    void TransformHierarchy::Destroy(const TTransformHandle handle)
+    {
+        ThrowIfReadOnly();
+
+        TTransformHandle child = m_first_children[handle];
+
+        while (child != k_invalid_transform_handle)
+        {
+            const TTransformHandle next_sibling = m_next_siblings[child];
+
+            m_parents[child] = k_invalid_transform_handle;
+            m_next_siblings[child] = k_invalid_transform_handle;
+            m_parent_slots[m_slot_of_handle[child]] = k_invalid_slot;
+            MarkSubtreeWorldDirty(child);
+
+            child = next_sibling;
+        }
+
+        m_first_children[handle] = k_invalid_transform_handle;
+
+        if (m_parents[handle] != k_invalid_transform_handle)
+        {
+            UnlinkChild(m_parents[handle], handle);
+            m_parents[handle] = k_invalid_transform_handle;
+        }
+
+        // The slot is left unused until the next sort compacts the arrays.
+        const TSlot slot = m_slot_of_handle[handle];
+        m_handle_of_slot[slot] = k_invalid_transform_handle;
+        m_is_world_dirty[slot] = 0U;
+        m_are_inverses_dirty[slot] = 0U;
+
+        m_slot_of_handle[handle] = k_invalid_slot;
+        m_free_handles.push_back(handle);
+        m_is_order_dirty = true;
+        m_are_levels_dirty = true;
+    }
+
+    void TransformHierarchy::SetParent(const TTransformHandle handle, const TTransformHandle parent)
+    {
+        ThrowIfReadOnly();
+
+        const TTransformHandle previous_parent = m_parents[handle];
+
+        if (previous_parent != k_invalid_transform_handle)
+        {
+            UnlinkChild(previous_parent, handle);
+        }
+
+        m_parents[handle] = parent;
+
+        if (parent != k_invalid_transform_handle)
+        {
+            LinkChild(parent, handle);
+        }
+
+        const TSlot slot = m_slot_of_handle[handle];
+        const TSlot parent_slot = (parent != k_invalid_transform_handle) ? m_slot_of_handle[parent] : k_invalid_slot;
+        m_parent_slots[slot] = parent_slot;
+
+        if ((parent_slot != k_invalid_slot) && (parent_slot > slot))
+        {
+            m_is_order_dirty = true;
+        }
+
+        m_are_levels_dirty = true;
+
+        MarkSubtreeWorldDirty(handle);
+    }
+
+    Vector3 TransformHierarchy::GetLocalPosition(const TTransformHandle handle) const
+    {
+        return m_local_positions[m_slot_of_handle[handle]];
+    }
+
+    void TransformHierarchy::SetLocalPosition(const TTransformHandle handle, const Vector3 &local_position)
+    {
+        ThrowIfReadOnly();
+
+        m_local_positions[m_slot_of_handle[handle]] = local_position;
+        MarkSubtreeWorldDirty(handle);
+    }
+
+    Quaternion TransformHierarchy::GetLocalRotation(const TTransformHandle handle) const
+    {
+        return m_local_rotations[m_slot_of_handle[handle]];
+    }
+
+    void TransformHierarchy::SetLocalRotation(const TTransformHandle handle, const Quaternion &local_rotation)
+    {
+        ThrowIfReadOnly();
+
+        m_local_rotations[m_slot_of_handle[handle]] = local_rotation;
+        MarkSubtreeWorldDirty(handle);
+    }
+
+    Vector3 TransformHierarchy::GetLocalScale(const TTransformHandle handle) const
+    {
+        return m_local_scales[m_slot_of_handle[handle]];
+    }
+
+    void TransformHierarchy::SetLocalScale(const TTransformHandle handle, const Vector3 &local_scale)
+    {
+        ThrowIfReadOnly();
+
+        m_local_scales[m_slot_of_handle[handle]] = local_scale;
+        MarkSubtreeWorldDirty(handle);
+    }
+
+    Matrix4x4 TransformHierarchy::GetLocalModelMatrix(const TTransformHandle handle) const
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        const Matrix4x4 local_matrix = Matrix4x4::FromTRS(m_local_positions[slot], m_local_rotations[slot],
+                                                          m_local_scales[slot]);
+
+        return local_matrix;
+    }
+
+    Matrix4x4 TransformHierarchy::GetParentWorldMatrix(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        UpdateWorldIfDirty(slot);
+
+        return m_parent_world_matrices[slot];
+    }
+
+    Quaternion TransformHierarchy::GetParentWorldRotation(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        UpdateWorldIfDirty(slot);
+
+        return m_parent_world_rotations[slot];
+    }
+
+    Vector3 TransformHierarchy::GetParentWorldScale(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        UpdateWorldIfDirty(slot);
+
+        return m_parent_world_scales[slot];
+    }
+
+    Matrix4x4 TransformHierarchy::GetWorldMatrix(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        UpdateWorldIfDirty(slot);
+
+        return m_world_matrices[slot];
+    }
+
+    std::uint32_t TransformHierarchy::GetWorldVersion(const TTransformHandle handle) const
+    {
+        return m_world_versions[handle];
+    }
+
+    Matrix4x4 TransformHierarchy::GetInverseParentWorldMatrix(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        if (m_is_read_only && (m_are_inverses_dirty[slot] != 0U))
+        {
+            return CalculateInverseParentWorldMatrix(slot);
+        }
+
+        UpdateInversesIfDirty(slot);
+
+        return m_inverse_parent_world_matrices[slot];
+    }
+
+    Quaternion TransformHierarchy::GetInverseParentWorldRotation(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        if (m_is_read_only && (m_are_inverses_dirty[slot] != 0U))
+        {
+            return CalculateInverseParentWorldRotation(slot);
+        }
+
+        UpdateInversesIfDirty(slot);
+
+        return m_inverse_parent_world_rotations[slot];
+    }
+
+    Vector3 TransformHierarchy::GetInverseParentWorldScale(const TTransformHandle handle)
+    {
+        const TSlot slot = m_slot_of_handle[handle];
+        if (m_is_read_only && (m_are_inverses_dirty[slot] != 0U))
+        {
+            return CalculateInverseParentWorldScale(slot);
+        }
+
+        UpdateInversesIfDirty(slot);
+
+        return m_inverse_parent_world_scales[slot];
+    }
+
+    void TransformHierarchy::UpdateWorldTransforms()
+    {
+        // Levels are only kept when the job system has threads to split them between.
+        const bool is_parallel = (JobSystem::GetInstance().GetThreadCount() > 1);
+
+        if (m_is_order_dirty || (is_parallel && m_are_levels_dirty))
+        {
+            SortSlots();
+        }
+
+        const auto slot_count = static_cast<TSlot>(m_handle_of_slot.size());
+
+        if (is_parallel)
+        {
+            UpdateDirtySlotsByLevel();
+        }
+        else
+        {
+            UpdateDirtySlots(m_first_dirty_slot, slot_count);
+        }
+
+        m_first_dirty_slot = slot_count;
+    }
+
+    void TransformHierarchy::SetReadOnly(const bool is_read_only)
+    {
+        if (is_read_only && !m_is_read_only)
+        {
+            UpdateWorldTransforms();
+        }
+
+        m_is_read_only = is_read_only;
+    }
+
+    bool TransformHierarchy::IsReadOnly() const
+    {
+        return m_is_read_only;
+    }
+
+    std::size_t TransformHierarchy::GetTransformCount() const
+    {
+        const std::size_t count = m_slot_of_handle.size() - m_free_handles.size();
+        return count;
+    }
+
+    // Stops at dirty transforms, whose descendants are already dirty.
+    void TransformHierarchy::MarkSubtreeWorldDirty(const TTransformHandle handle)
+    {
+        m_handle_stack.push_back(handle);
+
+        while (!m_handle_stack.empty())
+        {
+            const TTransformHandle current = m_handle_stack.back();
+            m_handle_stack.pop_back();
+
+            const TSlot slot = m_slot_of_handle[current];
+            if (m_is_world_dirty[slot] != 0U)
+            {
+                continue;
+            }
+
+            m_is_world_dirty[slot] = 1U;
+            m_first_dirty_slot = std::min(m_first_dirty_slot, slot);
+            ++m_world_versions[current];
+
+            for (TTransformHandle child = m_first_children[current];
+                 child != k_invalid_transform_handle;
+                 child = m_next_siblings[child])
+            {
+                m_handle_stack.push_back(child);
+            }
+        }
+    }
+
+    void TransformHierarchy::LinkChild(const TTransformHandle parent, const TTransformHandle child)
+    {
+        m_next_siblings[child] = m_first_children[parent];
+        m_first_children[parent] = child;
+    }
+
+    void TransformHierarchy::UnlinkChild(const TTransformHandle parent, const TTransformHandle child)
+    {
+        TTransformHandle *link = &m_first_children[parent];
+
+        while ((*link != k_invalid_transform_handle) && (*link != child))
+        {
+            link = &m_next_siblings[*link];
+        }
+
+        if (*link == child)
+        {
+            *link = m_next_siblings[child];
+        }
+
+        m_next_siblings[child] = k_invalid_transform_handle;
+    }
+
+    void TransformHierarchy::ThrowIfReadOnly() const
+    {
+        if (m_is_read_only)
+        {
+            throw ExceptionWithStacktrace("Transforms cannot be changed while the hierarchy is read only.");
+        }
+    }
+
+    void TransformHierarchy::UpdateWorldIfDirty(const TSlot slot)
+    {
+        if (m_is_world_dirty[slot] == 0U)
+        {
+            return;
+        }
+
+        // The dirty ancestors are refreshed first. They are collected without recursion,
+        // since hierarchies can be deep.
+        m_slot_stack.clear();
+
+        for (TSlot current = slot;
+             (current != k_invalid_slot) && (m_is_world_dirty[current] != 0U);
+             current = m_parent_slots[current])
+        {
+            m_slot_stack.push_back(current);
+        }
+
+        while (!m_slot_stack.empty())
+        {
+            UpdateWorld(m_slot_stack.back());
+            m_slot_stack.pop_back();
+        }
+    }
+
+    void TransformHierarchy::UpdateInversesIfDirty(const TSlot slot)
+    {
+        UpdateWorldIfDirty(slot);
+
+        if (m_are_inverses_dirty[slot] == 0U)
+        {
+            return;
+        }
+
+        m_inverse_parent_world_matrices[slot] = CalculateInverseParentWorldMatrix(slot);
+        m_inverse_parent_world_rotations[slot] = CalculateInverseParentWorldRotation(slot);
+        m_inverse_parent_world_scales[slot] = CalculateInverseParentWorldScale(slot);
+        m_are_inverses_dirty[slot] = 0U;
+    }
+
+    // A product of TRS matrices can shear, so only the affine shortcut applies.
+    Matrix4x4 TransformHierarchy::CalculateInverseParentWorldMatrix(const TSlot slot) const
+    {
+        const Matrix4x4 inverse = Matrix4x4::InverseAffine(m_parent_world_matrices[slot]);
+        return inverse;
+    }
+
+    Quaternion TransformHierarchy::CalculateInverseParentWorldRotation(const TSlot slot) const
+    {
+        const Quaternion inverse = Quaternion::Inverse(m_parent_world_rotations[slot]);
+        return inverse;
+    }
+
+    Vector3 TransformHierarchy::CalculateInverseParentWorldScale(const TSlot slot) const
+    {
+        const Vector3 &parent_world_scale = m_parent_world_scales[slot];
+
+        const Vector3 inverse(1.0F / parent_world_scale.x(), 1.0F / parent_world_scale.y(), 1.0F / parent_world_scale.z());
+        return inverse;
+    }
+
+    // Expects the parent to be up to date.
+    void TransformHierarchy::UpdateWorld(const TSlot slot)
+    {
+        const TSlot parent_slot = m_parent_slots[slot];
+
+        if (parent_slot != k_invalid_slot)
+        {
+            const Matrix4x4 parent_local_matrix = Matrix4x4::FromTRS(m_local_positions[parent_slot],
+                                                                        m_local_rotations[parent_slot],
+                                                                        m_local_scales[parent_slot]);
+
+            m_parent_world_matrices[slot] = m_parent_world_matrices[parent_slot] * parent_local_matrix;
+            m_parent_world_rotations[slot] = m_parent_world_rotations[parent_slot] * m_local_rotations[parent_slot];
+            m_parent_world_scales[slot] = Vector3::Scale(m_parent_world_scales[parent_slot], m_local_scales[parent_slot]);
+        }
+        else
+        {
+            m_parent_world_matrices[slot] = Matrix4x4(1.0F);
+            m_parent_world_rotations[slot] = QuaternionConstants::k_identity;
+            m_parent_world_scales[slot] = Vector3Constants::k_one;
+        }
+
+        const Vector4 world_position = m_parent_world_matrices[slot] * Vector4(m_local_positions[slot], 1.0F);
+        const Quaternion world_rotation = m_parent_world_rotations[slot] * m_local_rotations[slot];
+        const Vector3 world_scale = Vector3::Scale(m_parent_world_scales[slot], m_local_scales[slot]);
+
+        m_world_matrices[slot] = Matrix4x4::FromTRS(Vector3(world_position.x(), world_position.y(), world_position.z()),
+                                                    world_rotation, world_scale);
+
+        m_is_world_dirty[slot] = 0U;
+        m_are_inverses_dirty[slot] = 1U;
+    }
+
+    // Parents are stored first, so they are always clean by the time their children are reached.
+    void TransformHierarchy::UpdateDirtySlots(const TSlot begin, const TSlot end)
+    {
+        for (TSlot slot = begin; slot < end; ++slot)
+        {
+            if (m_is_world_dirty[slot] != 0U)
+            {
+                UpdateWorld(slot);
+            }
+        }
+    }
+
+    // The transforms of a level only read the level above, so each level is split between the
+    // threads, and the next one starts after all of them finish.
+    void TransformHierarchy::UpdateDirtySlotsByLevel()
+    {
+        auto& job_system = JobSystem::GetInstance();
+        const std::size_t thread_count = job_system.GetThreadCount();
+
+        for (std::size_t level = 0; (level + 1) < m_level_offsets.size(); ++level)
+        {
+            const TSlot begin = std::max(m_level_offsets[level], m_first_dirty_slot);
+            const TSlot end = m_level_offsets[level + 1];
+
+            if (begin >= end)
+            {
+                continue;
+            }
+
+            const std::size_t count = end - begin;
+            if (count < (2 * UtilsConstants::k_min_transforms_per_propagation_job))
+            {
+                UpdateDirtySlots(begin, end);
+                continue;
+            }
+
+            const std::size_t chunk_size = std::max<std::size_t>(UtilsConstants::k_min_transforms_per_propagation_job,
+                                                                 count / (4 * thread_count));
+
+            job_system.ParallelFor(count, chunk_size, [this, begin](const std::size_t chunk_begin, const std::size_t chunk_end)
+            {
+                UpdateDirtySlots(begin + static_cast<TSlot>(chunk_begin), begin + static_cast<TSlot>(chunk_end));
+            });
+        }
+    }
+
+    // Stores the transforms level by level, so that parents precede their children, and drops
+    // the slots of destroyed transforms.
+    void TransformHierarchy::SortSlots()
+    {
+        std::vector<TTransformHandle> order;
+        order.reserve(GetTransformCount());
+
+        for (TTransformHandle handle = 0; handle < m_slot_of_handle.size(); ++handle)
+        {
+            const bool is_alive_root = (m_slot_of_handle[handle] != k_invalid_slot)
+                                       && (m_parents[handle] == k_invalid_transform_handle);
+            if (is_alive_root)
+            {
+                order.push_back(handle);
+            }
+        }
+
+        m_level_offsets.assign(1, 0);
+
+        for (std::size_t level_begin = 0; level_begin < order.size(); )
+        {
+            const std::size_t level_end = order.size();
+            m_level_offsets.push_back(static_cast<TSlot>(level_end));
+
+            for (std::size_t i = level_begin; i < level_end; ++i)
+            {
+                for (TTransformHandle child = m_first_children[order[i]];
+                     child != k_invalid_transform_handle;
+                     child = m_next_siblings[child])
+                {
+                    order.push_back(child);
+                }
+            }
+
+            level_begin = level_end;
+        }
+
+        std::vector<TSlot> old_slots(order.size());
+        (void)std::transform(order.cbegin(), order.cend(), old_slots.begin(),
+                             [this](const TTransformHandle handle) { return m_slot_of_handle[handle]; });
+
+        PermuteSlots(m_local_positions, old_slots);
+        PermuteSlots(m_local_rotations, old_slots);
+        PermuteSlots(m_local_scales, old_slots);
+        PermuteSlots(m_parent_world_matrices, old_slots);
+        PermuteSlots(m_parent_world_rotations, old_slots);
+        PermuteSlots(m_parent_world_scales, old_slots);
+        PermuteSlots(m_world_matrices, old_slots);
+        PermuteSlots(m_inverse_parent_world_matrices, old_slots);
+        PermuteSlots(m_inverse_parent_world_rotations, old_slots);
+        PermuteSlots(m_inverse_parent_world_scales, old_slots);
+        PermuteSlots(m_is_world_dirty, old_slots);
+        PermuteSlots(m_are_inverses_dirty, old_slots);
+
+        for (TSlot slot = 0; slot < order.size(); ++slot)
+        {
+            m_slot_of_handle[order[slot]] = slot;
+        }
+
+        m_parent_slots.resize(order.size());
+        for (TSlot slot = 0; slot < order.size(); ++slot)
+        {
+            const TTransformHandle parent = m_parents[order[slot]];
+            m_parent_slots[slot] = (parent != k_invalid_transform_handle) ? m_slot_of_handle[parent] : k_invalid_slot;
+        }
+
+        m_handle_of_slot = std::move(order);
+        m_first_dirty_slot = 0;
+        m_is_order_dirty = false;
+        m_are_levels_dirty = false;
+    }
+}
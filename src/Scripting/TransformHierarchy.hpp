@@ -0,0 +1,149 @@
+#ifndef MG3TR_SRC_SCRIPTING_TRANSFORMHIERARCHY_HPP_INCLUDED
+#define MG3TR_SRC_SCRIPTING_TRANSFORMHIERARCHY_HPP_INCLUDED
+
+#include <Math/Matrix4x4.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace MG3TR
+{
+    using TTransformHandle = std::uint32_t;
+
+    const TTransformHandle k_invalid_transform_handle = std::numeric_limits<TTransformHandle>::max();
+
+    // Process wide storage of the transform data, one array per field. Handles stay valid for the
+    // lifetime of a transform, while the data is kept at a slot that is reassigned when the
+    // hierarchy changes, so that parents are stored before their children. World state is then
+    // refreshed with a single pass over the arrays.
+    //
+    // When the job system has more than one thread, each level of the hierarchy is split between
+    // its threads. Every transform is computed the same way in both modes, so the results match
+    // bit for bit.
+    //
+    // "Parent world" values map the parent's space to world space; the world matrix of a transform
+    // is built from its world position, rotation and scale.
+    class TransformHierarchy
+    {
+    private:
+        using TSlot = std::uint32_t;
+
+        static constexpr TSlot k_invalid_slot = std::numeric_limits<TSlot>::max();
+
+        // Indexed by handle.
+        std::vector<TSlot> m_slot_of_handle;
+        std::vector<TTransformHandle> m_parents;
+        std::vector<TTransformHandle> m_first_children;
+        std::vector<TTransformHandle> m_next_siblings;
+        std::vector<TTransformHandle> m_free_handles;
+        std::vector<std::uint32_t> m_world_versions;
+
+        // Indexed by slot.
+        std::vector<TTransformHandle> m_handle_of_slot;
+        std::vector<TSlot> m_parent_slots;
+        std::vector<Vector3> m_local_positions;
+        std::vector<Quaternion> m_local_rotations;
+        std::vector<Vector3> m_local_scales;
+        std::vector<Matrix4x4> m_parent_world_matrices;
+        std::vector<Quaternion> m_parent_world_rotations;
+        std::vector<Vector3> m_parent_world_scales;
+        std::vector<Matrix4x4> m_world_matrices;
+        std::vector<Matrix4x4> m_inverse_parent_world_matrices;
+        std::vector<Quaternion> m_inverse_parent_world_rotations;
+        std::vector<Vector3> m_inverse_parent_world_scales;
+        // A dirty transform always has dirty descendants.
+        std::vector<std::uint8_t> m_is_world_dirty;
+        std::vector<std::uint8_t> m_are_inverses_dirty;
+
+        TSlot m_first_dirty_slot;
+        bool m_is_order_dirty;
+
+        // First slot of each depth, followed by the slot count. Only kept up to date for
+        // parallel propagation, which needs every level stored contiguously.
+        std::vector<TSlot> m_level_offsets;
+        bool m_are_levels_dirty;
+
+        bool m_is_read_only;
+
+        std::vector<TTransformHandle> m_handle_stack;
+        std::vector<TSlot> m_slot_stack;
+
+        static TransformHierarchy m_instance;
+
+        TransformHierarchy();
+        ~TransformHierarchy() = default;
+
+    public:
+        TransformHierarchy(const TransformHierarchy &) = delete;
+        TransformHierarchy(TransformHierarchy &&) = delete;
+
+        TransformHierarchy& operator=(const TransformHierarchy &) = delete;
+        TransformHierarchy& operator=(TransformHierarchy &&) = delete;
+
+        static TransformHierarchy& GetInstance();
+
+        TTransformHandle Create();
+        // The children of the destroyed transform become roots.
+        void Destroy(const TTransformHandle handle);
+
+        void SetParent(const TTransformHandle handle, const TTransformHandle parent);
+
+        Vector3 GetLocalPosition(const TTransformHandle handle) const;
+        void SetLocalPosition(const TTransformHandle handle, const Vector3 &local_position);
+
+        Quaternion GetLocalRotation(const TTransformHandle handle) const;
+        void SetLocalRotation(const TTransformHandle handle, const Quaternion &local_rotation);
+
+        Vector3 GetLocalScale(const TTransformHandle handle) const;
+        void SetLocalScale(const TTransformHandle handle, const Vector3 &local_scale);
+
+        Matrix4x4 GetLocalModelMatrix(const TTransformHandle handle) const;
+
+        Matrix4x4 GetParentWorldMatrix(const TTransformHandle handle);
+        Quaternion GetParentWorldRotation(const TTransformHandle handle);
+        Vector3 GetParentWorldScale(const TTransformHandle handle);
+        Matrix4x4 GetWorldMatrix(const TTransformHandle handle);
+
+        // Changes every time the world state of the transform goes stale, so that values derived
+        // from it can be cached and compared against it.
+        std::uint32_t GetWorldVersion(const TTransformHandle handle) const;
+
+        Matrix4x4 GetInverseParentWorldMatrix(const TTransformHandle handle);
+        Quaternion GetInverseParentWorldRotation(const TTransformHandle handle);
+        Vector3 GetInverseParentWorldScale(const TTransformHandle handle);
+
+        // Refreshes the world state of every dirty transform, parents first.
+        void UpdateWorldTransforms();
+
+        // While read only, the getters neither refresh nor cache anything, so they can be called from
+        // several threads at once, and every change throws. The world state is refreshed on entering.
+        void SetReadOnly(const bool is_read_only);
+        bool IsReadOnly() const;
+
+        std::size_t GetTransformCount() const;
+
+    private:
+        void MarkSubtreeWorldDirty(const TTransformHandle handle);
+        void LinkChild(const TTransformHandle parent, const TTransformHandle child);
+        void UnlinkChild(const TTransformHandle parent, const TTransformHandle child);
+
+        void ThrowIfReadOnly() const;
+
+        void UpdateWorldIfDirty(const TSlot slot);
+        void UpdateInversesIfDirty(const TSlot slot);
+        Matrix4x4 CalculateInverseParentWorldMatrix(const TSlot slot) const;
+        Quaternion CalculateInverseParentWorldRotation(const TSlot slot) const;
+        Vector3 CalculateInverseParentWorldScale(const TSlot slot) const;
+        void UpdateWorld(const TSlot slot);
+        void UpdateDirtySlots(const TSlot begin, const TSlot end);
+        void UpdateDirtySlotsByLevel();
+
+        void SortSlots();
+    };
+}
+
+#endif // MG3TR_SRC_SCRIPTING_TRANSFORMHIERARCHY_HPP_INCLUDED
@@ -0,0 +1,345 @@
+#include "JobSystem.hpp"
+
+#include <Utils/ExceptionWithStacktrace.hpp>
+
+#include <algorithm>
+#include <format>
+#include <string>
+#include <utility>
+
+namespace MG3TR
+{
+    JobGraph::JobGraph()
+        : m_functions(),
+          m_dependents(),
+          m_prerequisite_counts()
+    {
+
+    }
+
+    TJobID JobGraph::AddJob(const TJobFunction &function)
+    {
+        const auto job = static_cast<TJobID>(m_functions.size());
+
+        m_functions.push_back(function);
+        m_dependents.emplace_back();
+        m_prerequisite_counts.push_back(0U);
+
+        return job;
+    }
+
+    void JobGraph::AddDependency(const TJobID job, const TJobID prerequisite)
+    {
+        const std::size_t job_count = m_functions.size();
+        if ((job >= job_count) || (prerequisite >= job))
+        {
+            const std::string error = std::format("Job {} cannot depend on job {} in a graph of {} jobs.",
+                                                  job, prerequisite, job_count);
+            throw ExceptionWithStacktrace(error);
+        }
+
+        m_dependents[prerequisite].push_back(job);
+        ++m_prerequisite_counts[job];
+    }
+
+    std::size_t JobGraph::GetJobCount() const
+    {
+        return m_functions.size();
+    }
+
+    void JobGraph::Clear()
+    {
+        m_functions.clear();
+        m_dependents.clear();
+        m_prerequisite_counts.clear();
+    }
+
+    thread_local std::size_t JobSystem::s_queue_index = 0;
+
+    JobSystem JobSystem::m_instance;
+
+    JobSystem::JobSystem()
+        : m_queues(),
+          m_threads(),
+          m_queued_job_count(0),
+          m_is_stopping(false)
+    {
+        m_queues.push_back(std::make_unique<JobQueue>());
+    }
+
+    JobSystem::~JobSystem()
+    {
+        StopThreads();
+    }
+
+    JobSystem& JobSystem::GetInstance()
+    {
+        return m_instance;
+    }
+
+    void JobSystem::SetThreadCount(const std::size_t thread_count)
+    {
+        StopThreads();
+        StartThreads((thread_count > 1) ? (thread_count - 1) : 0);
+    }
+
+    std::size_t JobSystem::GetThreadCount() const
+    {
+        return m_threads.size() + 1;
+    }
+
+    void JobSystem::Run(const JobGraph &graph)
+    {
+        const std::size_t job_count = graph.GetJobCount();
+        if (job_count == 0)
+        {
+            return;
+        }
+
+        std::vector<std::atomic<std::uint32_t>> remaining_prerequisites(job_count);
+        for (std::size_t i = 0; i < job_count; ++i)
+        {
+            remaining_prerequisites[i].store(graph.m_prerequisite_counts[i], std::memory_order_relaxed);
+        }
+
+        JobCounter counter;
+        counter.m_pending_count.store(job_count, std::memory_order_relaxed);
+        counter.m_has_failed.store(false, std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < job_count; ++i)
+        {
+            if (graph.m_prerequisite_counts[i] == 0U)
+            {
+                ScheduleGraphJob(graph, static_cast<TJobID>(i), counter, remaining_prerequisites);
+            }
+        }
+
+        Wait(counter);
+    }
+
+    void JobSystem::ParallelFor(const std::size_t count, const std::size_t chunk_size,
+                                const std::function<void(std::size_t, std::size_t)> &function)
+    {
+        const std::size_t chunk = std::max<std::size_t>(chunk_size, 1);
+
+        if (m_threads.empty() || (count <= chunk))
+        {
+            for (std::size_t begin = 0; begin < count; begin += chunk)
+            {
+                function(begin, std::min(begin + chunk, count));
+            }
+            return;
+        }
+
+        JobCounter counter;
+        counter.m_pending_count.store((count + chunk - 1) / chunk, std::memory_order_relaxed);
+        counter.m_has_failed.store(false, std::memory_order_relaxed);
+
+        for (std::size_t begin = 0; begin < count; begin += chunk)
+        {
+            const std::size_t end = std::min(begin + chunk, count);
+
+            Push(Job{ [&counter, &function, begin, end]()
+            {
+                if (!counter.m_has_failed.load(std::memory_order_relaxed))
+                {
+                    function(begin, end);
+                }
+            }, &counter });
+        }
+
+        Wait(counter);
+    }
+
+    void JobSystem::StartThreads(const std::size_t worker_count)
+    {
+        m_is_stopping = false;
+
+        while (m_queues.size() < (worker_count + 1))
+        {
+            m_queues.push_back(std::make_unique<JobQueue>());
+        }
+
+        m_threads.reserve(worker_count);
+
+        for (std::size_t i = 0; i < worker_count; ++i)
+        {
+            m_threads.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+        }
+    }
+
+    void JobSystem::StopThreads()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_is_stopping = true;
+        }
+
+        m_job_queued.notify_all();
+
+        for (auto &thread : m_threads)
+        {
+            thread.join();
+        }
+
+        m_threads.clear();
+        m_queues.resize(1);
+    }
+
+    void JobSystem::WorkerLoop(const std::size_t queue_index)
+    {
+        s_queue_index = queue_index;
+
+        while (true)
+        {
+            Job job;
+            if (TryPop(job))
+            {
+                Execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_job_queued.wait(lock, [this]() { return m_is_stopping || (m_queued_job_count.load() > 0); });
+
+            if (m_is_stopping)
+            {
+                return;
+            }
+        }
+    }
+
+    void JobSystem::Push(Job &&job)
+    {
+        JobQueue &queue = *m_queues[(s_queue_index < m_queues.size()) ? s_queue_index : 0];
+
+        {
+            const std::lock_guard<std::mutex> lock(queue.m_mutex);
+            queue.m_jobs.push_back(std::move(job));
+        }
+
+        // Counted under the sleep mutex, so that a worker cannot miss it between checking and sleeping.
+        {
+            const std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            (void)m_queued_job_count.fetch_add(1);
+        }
+
+        m_job_queued.notify_one();
+    }
+
+    // The newest job of the own queue first, then the oldest job of the next non-empty queue.
+    bool JobSystem::TryPop(Job &job)
+    {
+        const std::size_t queue_count = m_queues.size();
+        const std::size_t own_index = (s_queue_index < queue_count) ? s_queue_index : 0;
+
+        {
+            JobQueue &queue = *m_queues[own_index];
+            const std::lock_guard<std::mutex> lock(queue.m_mutex);
+
+            if (!queue.m_jobs.empty())
+            {
+                job = std::move(queue.m_jobs.back());
+                queue.m_jobs.pop_back();
+                (void)m_queued_job_count.fetch_sub(1);
+                return true;
+            }
+        }
+
+        for (std::size_t i = 1; i < queue_count; ++i)
+        {
+            JobQueue &queue = *m_queues[(own_index + i) % queue_count];
+            const std::lock_guard<std::mutex> lock(queue.m_mutex);
+
+            if (!queue.m_jobs.empty())
+            {
+                job = std::move(queue.m_jobs.front());
+                queue.m_jobs.pop_front();
+                (void)m_queued_job_count.fetch_sub(1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::Execute(Job &job)
+    {
+        JobCounter &counter = *job.m_counter;
+
+        try
+        {
+            job.m_function();
+        }
+        catch (...)
+        {
+            RecordException(counter);
+        }
+
+        // The waiting thread may return and destroy the counter as soon as this reaches 0.
+        (void)counter.m_pending_count.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // Called from a catch block; only the first exception is kept.
+    void JobSystem::RecordException(JobCounter &counter)
+    {
+        const std::lock_guard<std::mutex> lock(counter.m_exception_mutex);
+
+        if (counter.m_exception == nullptr)
+        {
+            counter.m_exception = std::current_exception();
+        }
+
+        counter.m_has_failed.store(true, std::memory_order_relaxed);
+    }
+
+    void JobSystem::Wait(JobCounter &counter)
+    {
+        while (counter.m_pending_count.load(std::memory_order_acquire) != 0)
+        {
+            Job job;
+            if (TryPop(job))
+            {
+                Execute(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (counter.m_exception != nullptr)
+        {
+            std::rethrow_exception(counter.m_exception);
+        }
+    }
+
+    // The job queues its dependents once their last prerequisite finishes, even if it failed, so that
+    // every job of the graph is accounted for.
+    void JobSystem::ScheduleGraphJob(const JobGraph &graph, const TJobID job, JobCounter &counter,
+                                     std::vector<std::atomic<std::uint32_t>> &remaining_prerequisites)
+    {
+        Push(Job{ [this, &graph, job, &counter, &remaining_prerequisites]()
+        {
+            if (!counter.m_has_failed.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    graph.m_functions[job]();
+                }
+                catch (...)
+                {
+                    RecordException(counter);
+                }
+            }
+
+            for (const TJobID dependent : graph.m_dependents[job])
+            {
+                if (remaining_prerequisites[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1U)
+                {
+                    ScheduleGraphJob(graph, dependent, counter, remaining_prerequisites);
+                }
+            }
+        }, &counter });
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef MG3TR_SRC_UTILS_JOBSYSTEM_HPP_INCLUDED
+#define MG3TR_SRC_UTILS_JOBSYSTEM_HPP_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace MG3TR
+{
+    using TJobFunction = std::function<void()>;
+    using TJobID = std::uint32_t;
+
+    // Jobs together with the order they have to run in. A graph can be run any number of times.
+    class JobGraph
+    {
+    private:
+        std::vector<TJobFunction> m_functions;
+        std::vector<std::vector<TJobID>> m_dependents;
+        std::vector<std::uint32_t> m_prerequisite_counts;
+
+        friend class JobSystem;
+
+    public:
+        JobGraph();
+        virtual ~JobGraph() = default;
+
+        JobGraph(const JobGraph &) = default;
+        JobGraph(JobGraph &&) = default;
+
+        JobGraph& operator=(const JobGraph &) = default;
+        JobGraph& operator=(JobGraph &&) = default;
+
+        TJobID AddJob(const TJobFunction &function);
+        // The job starts only after the prerequisite has finished. Jobs can only depend on jobs
+        // added before them, which keeps the graph free of cycles.
+        void AddDependency(const TJobID job, const TJobID prerequisite);
+
+        std::size_t GetJobCount() const;
+        void Clear();
+    };
+
+    // Runs jobs on a fixed set of worker threads and on the threads that wait for them.
+    //
+    // Every thread has its own queue. A thread takes the jobs it queued itself newest first, and
+    // steals the oldest jobs of the other queues once its own is empty. Threads waiting for jobs keep
+    // running queued jobs, so jobs may queue and wait for more jobs.
+    //
+    // If a job throws, the jobs of the same call that have not started yet are skipped, and the
+    // first exception is rethrown to the caller once the running ones finish.
+    class JobSystem
+    {
+    private:
+        struct JobCounter
+        {
+            std::atomic<std::size_t> m_pending_count;
+            std::atomic<bool> m_has_failed;
+            std::mutex m_exception_mutex;
+            std::exception_ptr m_exception;
+        };
+
+        struct Job
+        {
+            TJobFunction m_function;
+            JobCounter *m_counter;
+        };
+
+        struct JobQueue
+        {
+            std::mutex m_mutex;
+            std::deque<Job> m_jobs;
+        };
+
+        // Index 0 is shared by every thread that is not a worker.
+        std::vector<std::unique_ptr<JobQueue>> m_queues;
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_job_queued;
+        std::atomic<std::size_t> m_queued_job_count;
+        bool m_is_stopping;
+
+        static thread_local std::size_t s_queue_index;
+
+        static JobSystem m_instance;
+
+        JobSystem();
+        ~JobSystem();
+
+    public:
+        JobSystem(const JobSystem &) = delete;
+        JobSystem(JobSystem &&) = delete;
+
+        JobSystem& operator=(const JobSystem &) = delete;
+        JobSystem& operator=(JobSystem &&) = delete;
+
+        static JobSystem& GetInstance();
+
+        // thread_count includes the calling thread, so a count of 0 or 1 runs every job on the thread
+        // that waits for it. Must not be called while jobs are running.
+        void SetThreadCount(const std::size_t thread_count);
+        std::size_t GetThreadCount() const;
+
+        // Runs the graph and returns once every job of it has finished.
+        void Run(const JobGraph &graph);
+
+        // Calls function(begin, end) for consecutive chunks of [0, count) and returns once all of them
+        // are done. The chunks may run in any order and on any thread.
+        void ParallelFor(const std::size_t count, const std::size_t chunk_size,
+                         const std::function<void(std::size_t, std::size_t)> &function);
+
+        // Calls function(element) for every element of the span, chunk_size elements per job.
+        template<typename Element, typename Function>
+        void ParallelForEach(const std::span<Element> elements, const std::size_t chunk_size, const Function &function);
+
+    private:
+        void StartThreads(const std::size_t worker_count);
+        void StopThreads();
+        void WorkerLoop(const std::size_t queue_index);
+
+        void Push(Job &&job);
+        bool TryPop(Job &job);
+        void Execute(Job &job);
+        static void RecordException(JobCounter &counter);
+        void Wait(JobCounter &counter);
+        void ScheduleGraphJob(const JobGraph &graph, const TJobID job, JobCounter &counter,
+                              std::vector<std::atomic<std::uint32_t>> &remaining_prerequisites);
+    };
+
+    template<typename Element, typename Function>
+    void JobSystem::ParallelForEach(const std::span<Element> elements, const std::size_t chunk_size, const Function &function)
+    {
+        ParallelFor(elements.size(), chunk_size, [&elements, &function](const std::size_t begin, const std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                function(elements[i]);
+            }
+        });
+    }
+}
+
+#endif // MG3TR_SRC_UTILS_JOBSYSTEM_HPP_INCLUDED
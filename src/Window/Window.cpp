@@ -6,11 +6,14 @@
 #include <GLFW/glfw3.h>
 
 #include <Constants/InputConstants.hpp>
+#include <Graphics/API/GLValidationLevel.hpp>
 #include <Graphics/API/GraphicsAPISingleton.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Scene/Scene.hpp>
 #include <Utils/ExceptionWithStacktrace.hpp>
 
 #include <iostream>
+#include <thread>
 
 static MG3TR::Input s_input;
 
@@ -73,6 +76,10 @@ static GLFWwindow* OpenNewWindow(const int height, const int width, const std::s
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+#   if MG3TR_GL_VALIDATION_LEVEL >= 2
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+#   endif
+
     GLFWwindow* const window = glfwCreateWindow(height, width, name.c_str(), nullptr, nullptr);
     if (window == nullptr)
     {
@@ -106,6 +113,8 @@ namespace MG3TR
         m_window = OpenNewWindow(height, width, name);
         SetGLFWCallbacks(m_window);
 
+        RenderQueue::GetInstance().SetRenderingThread(std::this_thread::get_id());
+
         api.Initialise(reinterpret_cast<void *>(glfwGetProcAddress));
 
         if (glfwRawMouseMotionSupported())
@@ -114,6 +123,7 @@ namespace MG3TR
         }
 
         m_scene = nullptr;
+        m_is_pipelined = false;
     }
     
     Window::~Window()
@@ -127,6 +137,16 @@ namespace MG3TR
         m_scene = std::move(scene);
     }
 
+    void Window::SetPipelined(const bool is_pipelined)
+    {
+        m_is_pipelined = is_pipelined;
+    }
+
+    bool Window::IsPipelined() const
+    {
+        return m_is_pipelined;
+    }
+
     void Window::Initialize()
     {
         auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
@@ -140,29 +160,91 @@ namespace MG3TR
     }
 
     void Window::KeepRunning()
+    {
+        if (m_is_pipelined)
+        {
+            RunPipelined();
+        }
+        else
+        {
+            RunSerially();
+        }
+    }
+
+    void Window::RunSerially()
     {
         auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+        auto& render_queue = RenderQueue::GetInstance();
 
         while (!glfwWindowShouldClose(m_window))
         {
             glfwPollEvents();
 
             api.ClearScreen();
-            
-            double xpos, ypos;
-            glfwGetCursorPos(m_window, &xpos, &ypos);
 
-            s_input.UpdateMousePosition({ static_cast<float>(xpos), static_cast<float>(ypos) });
+            UpdateScene();
+            render_queue.Execute();
 
-            const auto current_time_point = std::chrono::system_clock::now();
-            const auto time_points_difference = current_time_point - m_last_update_time_point;
-            const float delta_time_seconds = static_cast<std::chrono::duration<float>>(time_points_difference).count();
+            glfwSwapBuffers(m_window);
+        }
+    }
 
-            m_scene->Update(s_input, delta_time_seconds);
+    // The render thread drains every published frame before it sees the interruption, so the
+    // queue is empty again once it has been joined. Releases handed to the queue after its last
+    // frame run here once the context is back.
+    void Window::RunPipelined()
+    {
+        auto& render_queue = RenderQueue::GetInstance();
 
-            m_last_update_time_point = current_time_point;
+        // A context can only be current on one thread at a time.
+        render_queue.SetRenderingThread(std::thread::id());
+        glfwMakeContextCurrent(nullptr);
 
-            glfwSwapBuffers(m_window);
+        std::thread render_thread([this, &render_queue]()
+        {
+            auto& api = GraphicsAPISingleton::GetInstance().GetGraphicsAPI();
+
+            glfwMakeContextCurrent(m_window);
+            render_queue.SetRenderingThread(std::this_thread::get_id());
+
+            while (render_queue.WaitForFrame())
+            {
+                api.ClearScreen();
+                render_queue.Execute();
+                glfwSwapBuffers(m_window);
+            }
+
+            render_queue.SetRenderingThread(std::thread::id());
+            glfwMakeContextCurrent(nullptr);
+        });
+
+        while (!glfwWindowShouldClose(m_window))
+        {
+            glfwPollEvents();
+            UpdateScene();
         }
+
+        render_queue.InterruptWait();
+        render_thread.join();
+
+        glfwMakeContextCurrent(m_window);
+        render_queue.SetRenderingThread(std::this_thread::get_id());
+        render_queue.RunPendingReleases();
+    }
+
+    void Window::UpdateScene()
+    {
+        double xpos, ypos;
+        glfwGetCursorPos(m_window, &xpos, &ypos);
+
+        s_input.UpdateMousePosition({ static_cast<float>(xpos), static_cast<float>(ypos) });
+
+        const auto current_time_point = std::chrono::system_clock::now();
+        const auto time_points_difference = current_time_point - m_last_update_time_point;
+        const float delta_time_seconds = static_cast<std::chrono::duration<float>>(time_points_difference).count();
+
+        m_scene->Update(s_input, delta_time_seconds);
+
+        m_last_update_time_point = current_time_point;
     }
 }
@@ -18,6 +18,7 @@ namespace MG3TR
         std::chrono::system_clock::time_point m_last_update_time_point;
 
         std::unique_ptr<Scene> m_scene;
+        bool m_is_pipelined;
 
     public:
         Window(const int height, const int width, const std::string &name);
@@ -31,8 +32,20 @@ namespace MG3TR
 
         void SetScene(std::unique_ptr<Scene> scene);
 
+        // When pipelined, a second thread draws each frame while this one updates the scene for the
+        // next, and the graphics context belongs to the drawing thread. Graphics objects the scene
+        // destroys meanwhile are deleted by the drawing thread after its next frame, but creating
+        // textures, meshes or shader programs throws, so they have to be created before KeepRunning.
+        void SetPipelined(const bool is_pipelined);
+        bool IsPipelined() const;
+
         void Initialize();
         void KeepRunning();
+
+    private:
+        void RunSerially();
+        void RunPipelined();
+        void UpdateScene();
     };
 }
 